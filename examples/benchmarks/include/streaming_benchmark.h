@@ -0,0 +1,255 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "ldtk_level.h"
+#include "ldtk_level_bgs_ptr.h"
+#include "ldtk_tile_grid_base.h"
+
+#include <bn_camera_ptr.h>
+#include <bn_core.h>
+#include <bn_display.h>
+#include <bn_fixed_point.h>
+#include <bn_math.h>
+#include <bn_point.h>
+#include <bn_string_view.h>
+
+#include <cstdint>
+
+// BG streaming benchmark of `level_bgs_manager`,
+// shared by the ROM (`examples/benchmarks`) and the host build (`host/`).
+//
+// It moves the camera along a scripted path, and measures only the update callback of `ldtk::core`,
+// which streams the cells with `reset_rows()`, `reset_columns()` and `reset_all_cells()`.
+
+namespace streaming_benchmark
+{
+
+enum class camera_path
+{
+    PAN_X,
+    DIAGONAL,
+    TELEPORT,
+    EDGES,
+};
+
+inline constexpr camera_path camera_paths[] = {
+    camera_path::PAN_X,
+    camera_path::DIAGONAL,
+    camera_path::TELEPORT,
+    camera_path::EDGES,
+};
+
+[[nodiscard]] constexpr auto camera_path_name(camera_path path) -> bn::string_view
+{
+    switch (path)
+    {
+    case camera_path::PAN_X:
+        return "pan_x";
+    case camera_path::DIAGONAL:
+        return "diagonal";
+    case camera_path::TELEPORT:
+        return "teleport";
+    case camera_path::EDGES:
+        return "edges";
+    }
+
+    return "?";
+}
+
+/// @brief Properties of a level that affect the streaming cost.
+struct level_info
+{
+    int bgs_count = 0;
+    int min_grid_size = 0;
+    int max_grid_size = 0;
+    bool bloated = false;
+    int flip_percent = 0;
+    bool smaller_than_screen = false;
+};
+
+[[nodiscard]] inline auto get_level_info(const ldtk::level& level) -> level_info
+{
+    level_info result;
+    int cells = 0;
+    int flipped_cells = 0;
+
+    for (const ldtk::layer& layer : level.layer_instances())
+    {
+        const ldtk::tile_grid_base* grid = layer.auto_layer_tiles() ? layer.auto_layer_tiles() : layer.grid_tiles();
+        if (!grid)
+            continue;
+
+        result.min_grid_size = result.bgs_count ? bn::min(result.min_grid_size, layer.grid_size()) : layer.grid_size();
+        result.max_grid_size = bn::max(result.max_grid_size, layer.grid_size());
+        result.bloated = result.bloated || grid->bloated();
+        ++result.bgs_count;
+
+        for (int y = 0; y < grid->c_height(); ++y)
+        {
+            for (int x = 0; x < grid->c_width(); ++x)
+            {
+                const ldtk::tile_grid_base::tile_info tile_info = grid->cell_tile_info(x, y);
+                flipped_cells += (tile_info.x_flip || tile_info.y_flip);
+                ++cells;
+            }
+        }
+    }
+
+    result.flip_percent = cells ? flipped_cells * 100 / cells : 0;
+    result.smaller_than_screen = level.px_width() < bn::display::width() || level.px_height() < bn::display::height();
+    return result;
+}
+
+/// @brief Triangle wave in `[-amplitude, amplitude]`, moving `1` per `t`.
+[[nodiscard]] constexpr auto triangle_wave(int t, int amplitude) -> int
+{
+    const int phase = t % (amplitude * 4);
+    return (phase < amplitude * 2) ? phase - amplitude : amplitude * 3 - phase;
+}
+
+/// @brief Camera position of the `frame`, where `(0, 0)` shows the center of the level.
+[[nodiscard]] constexpr auto camera_position(camera_path path, const ldtk::level& level, int frame)
+    -> bn::fixed_point
+{
+    // Keep the screen inside the level, unless the level is smaller than the screen
+    const int range_x = bn::max(level.px_width() / 2 - bn::display::width() / 2, 32);
+    const int range_y = bn::max(level.px_height() / 2 - bn::display::height() / 2, 32);
+
+    switch (path)
+    {
+    case camera_path::PAN_X:
+        return bn::fixed_point(triangle_wave(frame * 2, range_x), 0);
+
+    case camera_path::DIAGONAL:
+        return bn::fixed_point(triangle_wave(frame * 3, range_x), triangle_wave(frame * 2, range_y));
+
+    case camera_path::TELEPORT: {
+        // Jumps to the other half of the level every frame, which reloads all the cells
+        const std::uint32_t hash = static_cast<std::uint32_t>(frame + 1) * 2654435761u;
+        const int x = static_cast<int>((hash >> 8) % static_cast<std::uint32_t>(range_x + 1));
+        const int y = static_cast<int>((hash >> 20) % static_cast<std::uint32_t>(range_y + 1));
+        return (frame % 2) ? bn::fixed_point(x, y) : bn::fixed_point(-x, -y);
+    }
+
+    case camera_path::EDGES: {
+        // Screen center goes around the level border, so that half of the screen is out-of-bound
+        const int half_width = level.px_width() / 2;
+        const int half_height = level.px_height() / 2;
+        const int perimeter = (level.px_width() + level.px_height()) * 2;
+        int distance = (frame * 4) % perimeter;
+
+        if (distance < level.px_width())
+            return bn::fixed_point(distance - half_width, -half_height);
+        distance -= level.px_width();
+        if (distance < level.px_height())
+            return bn::fixed_point(half_width, distance - half_height);
+        distance -= level.px_height();
+        if (distance < level.px_width())
+            return bn::fixed_point(half_width - distance, half_height);
+        distance -= level.px_width();
+        return bn::fixed_point(-half_width, half_height - distance);
+    }
+    }
+
+    return bn::fixed_point();
+}
+
+/// @brief Top-left 8x8 cell of the screen for the layer.
+[[nodiscard]] constexpr auto screen_top_left_cell(const ldtk::level& level, const ldtk::layer& layer,
+                                                  const bn::fixed_point& camera_position) -> bn::point
+{
+    // Same as `bg_t::apply_layer_diff()` & `bg_t::reset_all_cells()`, with the level placed at `(0, 0)`
+    const bn::fixed_point final_pos(
+        (-camera_position.x() + layer.px_total_offset_x()) * (1 - layer.def().parallax_factor_x()),
+        (-camera_position.y() + layer.px_total_offset_y()) * (1 - layer.def().parallax_factor_y()));
+    const bn::fixed_point screen_top_left =
+        -final_pos - bn::fixed_point(bn::display::width() / 2, bn::display::height() / 2) +
+        bn::fixed_point(level.px_width() / 2, level.px_height() / 2);
+
+    return bn::point((screen_top_left.x() / 8).floor_integer(), (screen_top_left.y() / 8).floor_integer());
+}
+
+/// @brief Number of the cells `level_bgs_manager` writes when the camera moves.
+[[nodiscard]] constexpr auto streamed_cells(const ldtk::level& level, const bn::fixed_point& prev_camera_position,
+                                            const bn::fixed_point& next_camera_position) -> int
+{
+    constexpr int SCREEN_COLUMNS = bn::display::width() / 8 + 1;
+    constexpr int SCREEN_ROWS = bn::display::height() / 8 + 1;
+
+    int result = 0;
+
+    for (const ldtk::layer& layer : level.layer_instances())
+    {
+        if (!layer.auto_layer_tiles() && !layer.grid_tiles())
+            continue;
+
+        const bn::point diff = screen_top_left_cell(level, layer, next_camera_position) -
+                               screen_top_left_cell(level, layer, prev_camera_position);
+        const int diff_x = bn::abs(diff.x());
+        const int diff_y = bn::abs(diff.y());
+
+        if (diff_x >= SCREEN_COLUMNS - 1 || diff_y >= SCREEN_ROWS - 1)
+            result += SCREEN_COLUMNS * SCREEN_ROWS;
+        else
+            result += diff_y * SCREEN_COLUMNS + diff_x * (SCREEN_ROWS - diff_y);
+    }
+
+    return result;
+}
+
+struct result
+{
+    int frames = 0;
+    int cells = 0;
+    std::int64_t elapsed = 0; // In the units of the `Clock`
+};
+
+/// @brief Runs the camera `path` on the `level` for `frames` frames.
+/// @tparam Clock Type with `restart()` and `elapsed() -> std::int64_t`.
+template <typename Clock>
+auto run(const ldtk::level& level, camera_path path, int frames, Clock& clock) -> result
+{
+    // Update callback can't capture, so the measurement is passed through these
+    static Clock* current_clock;
+    static bn::core::update_callback_type ldtk_update_callback;
+    static std::int64_t elapsed;
+
+    bn::camera_ptr camera = bn::camera_ptr::create(camera_position(path, level, 0));
+    ldtk::level_bgs_ptr level_bgs = level.create_bgs(0, 0);
+    level_bgs.set_camera(camera);
+
+    // Initial fill isn't measured
+    bn::core::update();
+
+    current_clock = &clock;
+    ldtk_update_callback = bn::core::update_callback();
+    elapsed = 0;
+
+    bn::core::set_update_callback([] {
+        current_clock->restart();
+        ldtk_update_callback();
+        elapsed += current_clock->elapsed();
+    });
+
+    result output;
+
+    for (int frame = 1; frame <= frames; ++frame)
+    {
+        const bn::fixed_point prev_position = camera.position();
+        const bn::fixed_point next_position = camera_position(path, level, frame);
+        camera.set_position(next_position);
+        bn::core::update();
+
+        output.cells += streamed_cells(level, prev_position, next_position);
+        ++output.frames;
+    }
+
+    bn::core::set_update_callback(ldtk_update_callback);
+
+    output.elapsed = elapsed;
+    return output;
+}
+
+} // namespace streaming_benchmark
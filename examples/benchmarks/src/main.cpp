@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "ldtk_core.h"
+#include "ldtk_level.h"
+#include "ldtk_project.h"
+
+#include "ldtk_gen_project.h"
+
+#include <bn_core.h>
+#include <bn_log.h>
+#include <bn_sprite_text_generator.h>
+#include <bn_string_view.h>
+#include <bn_timer.h>
+
+#include "common_info.h"
+#include "common_variable_8x16_sprite_font.h"
+
+#include "streaming_benchmark.h"
+
+#include <cstdint>
+
+namespace
+{
+
+// `bn::timer` ticks once per 64 CPU cycles
+constexpr int CYCLES_PER_TICK = 64;
+
+constexpr int FRAMES_PER_RUN = 120;
+
+struct gba_clock
+{
+    bn::timer timer;
+
+    void restart()
+    {
+        timer.restart();
+    }
+
+    [[nodiscard]] auto elapsed() const -> std::int64_t
+    {
+        return std::int64_t(timer.elapsed_ticks()) * CYCLES_PER_TICK;
+    }
+};
+
+void run_benchmarks()
+{
+    const ldtk::project& project = ldtk::gen::gen_project;
+    gba_clock clock;
+
+    BN_LOG("level, grid, storage, flip%, bgs, oob, path, cycles/frame, cycles/cell");
+
+    int level_index = 0;
+
+    for (const ldtk::level& level : project.levels())
+    {
+        const streaming_benchmark::level_info info = streaming_benchmark::get_level_info(level);
+
+        for (streaming_benchmark::camera_path path : streaming_benchmark::camera_paths)
+        {
+            const streaming_benchmark::result result =
+                streaming_benchmark::run(level, path, FRAMES_PER_RUN, clock);
+
+            const int cycles_per_frame = int(result.elapsed / result.frames);
+            const int cycles_per_cell = result.cells ? int(result.elapsed / result.cells) : 0;
+
+            BN_LOG(level_index, ", ", info.min_grid_size, "-", info.max_grid_size, ", ",
+                   info.bloated ? "u16" : "u8", ", ", info.flip_percent, ", ", info.bgs_count, ", ",
+                   info.smaller_than_screen, ", ", streaming_benchmark::camera_path_name(path), ", ",
+                   cycles_per_frame, ", ", cycles_per_cell);
+        }
+
+        ++level_index;
+    }
+}
+
+} // namespace
+
+int main()
+{
+    bn::core::init();
+    ldtk::core::init();
+
+    run_benchmarks();
+
+    constexpr bn::string_view info_text_lines[] = {
+        "Results are written to the",
+        "emulator log (e.g. mGBA)",
+    };
+
+    bn::sprite_text_generator text_generator(common::variable_8x16_sprite_font);
+    common::info info("Benchmarks done", info_text_lines, text_generator);
+
+    while (true)
+    {
+        info.update();
+        bn::core::update();
+    }
+}
@@ -9,6 +9,14 @@
 #include "bn_sprite_ptr.h"
 #include "bn_vector.h"
 
+#include "ldtk_level_bgs_stats.h"
+
+// Logs the CPU usage of every frame, which is parsed by `tools/benchmarks/frame_time_harness.py`.
+// Requires `BN_CFG_LOG_ENABLED` too.
+#ifndef COMMON_CFG_FRAME_LOG_ENABLED
+    #define COMMON_CFG_FRAME_LOG_ENABLED false
+#endif
+
 namespace bn
 {
 class sprite_text_generator;
@@ -25,7 +33,8 @@ public:
     {
         DISABLED,
         SIMPLE,
-        DETAILED
+        DETAILED,
+        LEVEL_BGS // DETAILED with the worst frame of `ldtk::core::stats()`, requires `LDTK_CFG_STATS_ENABLED`
     };
 
     explicit stats(bn::sprite_text_generator& text_generator);
@@ -47,6 +56,14 @@ private:
     bn::fixed _max_cpu_usage;
     mode_type _mode = mode_type::SIMPLE;
     int _counter = 0;
+    int _frame_index = 0;
+
+#if LDTK_CFG_STATS_ENABLED
+    void _update_level_bgs_text();
+
+    bn::vector<bn::sprite_ptr, 24> _level_bgs_text_sprites;
+    ldtk::frame_stats _worst_level_bgs_frame;
+#endif
 };
 
 } // namespace common
@@ -7,13 +7,46 @@
 
 #include "bn_core.h"
 #include "bn_display.h"
+#include "bn_log.h"
 #include "bn_memory.h"
 #include "bn_sprite_text_generator.h"
 #include "bn_string.h"
 
+#include "ldtk_core.h"
+
 namespace common
 {
 
+#if LDTK_CFG_STATS_ENABLED
+namespace
+{
+
+[[nodiscard]] bn::string_view reload_reason_name(ldtk::reload_reason reason)
+{
+    switch (reason)
+    {
+
+    case ldtk::reload_reason::SET_LEVEL:
+        return "set level";
+
+    case ldtk::reload_reason::FORCE_RELOAD:
+        return "force reload";
+
+    case ldtk::reload_reason::BIG_JUMP:
+        return "big jump";
+
+    case ldtk::reload_reason::VISIBILITY:
+        return "visibility";
+
+    default:
+        BN_ERROR("Invalid reload reason: ", int(reason));
+        return "";
+    }
+}
+
+} // namespace
+#endif
+
 stats::stats(bn::sprite_text_generator& text_generator) : _text_generator(text_generator)
 {
     set_mode(_mode);
@@ -29,6 +62,11 @@ void stats::set_mode(mode_type mode)
     _max_cpu_usage = 0;
     _counter = 0;
 
+#if LDTK_CFG_STATS_ENABLED
+    _level_bgs_text_sprites.clear();
+    _worst_level_bgs_frame = ldtk::frame_stats();
+#endif
+
     switch (mode)
     {
 
@@ -39,7 +77,10 @@ void stats::set_mode(mode_type mode)
         _text_position = bn::fixed_point(text_x, text_height - (bn::display::height() / 2));
         break;
 
-    case mode_type::DETAILED: {
+    case mode_type::DETAILED:
+    case mode_type::LEVEL_BGS: {
+        BN_ASSERT(mode != mode_type::LEVEL_BGS || LDTK_CFG_STATS_ENABLED, "LDTK_CFG_STATS_ENABLED is disabled");
+
         bn::string_view cpu_label = "CPU: ";
         bn::fixed cpu_label_width = _text_generator.width(cpu_label);
         _text_position = bn::fixed_point(text_x + cpu_label_width, text_height - (bn::display::height() / 2));
@@ -76,6 +117,12 @@ void stats::set_mode(mode_type mode)
 
 void stats::update()
 {
+#if COMMON_CFG_FRAME_LOG_ENABLED
+    // Raw `bn::fixed` data, 4096 is a full frame
+    BN_LOG("[frame] ", _frame_index, ' ', bn::core::last_cpu_usage().data());
+    ++_frame_index;
+#endif
+
     switch (_mode)
     {
 
@@ -88,6 +135,18 @@ void stats::update()
     case mode_type::DETAILED:
         break;
 
+    case mode_type::LEVEL_BGS:
+#if LDTK_CFG_STATS_ENABLED
+        if (const ldtk::level_bgs_stats& level_bgs_stats = ldtk::core::stats(); level_bgs_stats.frames_count())
+        {
+            const ldtk::frame_stats& last_frame = level_bgs_stats.frame(0);
+
+            if (last_frame.update_cycles >= _worst_level_bgs_frame.update_cycles)
+                _worst_level_bgs_frame = last_frame;
+        }
+#endif
+        break;
+
     default:
         BN_ERROR("Invalid mode: ", int(_mode));
         break;
@@ -112,6 +171,7 @@ void stats::update()
             break;
 
         case mode_type::DETAILED:
+        case mode_type::LEVEL_BGS:
             text_stream.set_precision(4);
             text_stream.append(max_cpu_pct);
             break;
@@ -130,9 +190,62 @@ void stats::update()
 
         _max_cpu_usage = 0;
         _counter = 60;
+
+#if LDTK_CFG_STATS_ENABLED
+        if (_mode == mode_type::LEVEL_BGS)
+        {
+            _update_level_bgs_text();
+            _worst_level_bgs_frame = ldtk::frame_stats();
+        }
+#endif
     }
 
     --_counter;
 }
 
+#if LDTK_CFG_STATS_ENABLED
+void stats::_update_level_bgs_text()
+{
+    // Below the static "CPU", "IWR" & "EWR" lines
+    int text_x = 8 - (bn::display::width() / 2);
+    int text_height = _text_generator.font().item().shape_size().height() + 4;
+    int text_y = _text_position.y().right_shift_integer() + (text_height * 3);
+
+    int old_bg_priority = _text_generator.bg_priority();
+    _text_generator.set_bg_priority(0);
+    _level_bgs_text_sprites.clear();
+
+    bn::string<48> text;
+    bn::ostringstream text_stream(text);
+    text_stream.append("BGS: ");
+    text_stream.append(_worst_level_bgs_frame.update_cycles);
+    text_stream.append("cyc ");
+    text_stream.append(_worst_level_bgs_frame.vram_bytes);
+    text_stream.append("B");
+    _text_generator.generate(text_x, text_y, text, _level_bgs_text_sprites);
+
+    // Cells rewritten by each layer in the worst frame
+    for (const ldtk::layer_frame_stats& layer : _worst_level_bgs_frame.layers)
+    {
+        text_y += text_height;
+        text.clear();
+        text_stream.append("L");
+        text_stream.append(int(layer.layer_identifier));
+        text_stream.append(": ");
+        text_stream.append(layer.cells);
+
+        if (layer.reload)
+        {
+            text_stream.append(" (");
+            text_stream.append(reload_reason_name(*layer.reload));
+            text_stream.append(")");
+        }
+
+        _text_generator.generate(text_x, text_y, text, _level_bgs_text_sprites);
+    }
+
+    _text_generator.set_bg_priority(old_bg_priority);
+}
+#endif
+
 } // namespace common
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "ldtk_core.h"
+#include "ldtk_level.h"
+#include "ldtk_level_bgs_ptr.h"
+#include "ldtk_project.h"
+
+#include "ldtk_gen_project.h"
+
+#include <bn_camera_ptr.h>
+#include <bn_core.h>
+#include <bn_keypad.h>
+#include <bn_sprite_text_generator.h>
+#include <bn_string_view.h>
+
+#include "common_info.h"
+#include "common_stats.h"
+#include "common_variable_8x16_sprite_font.h"
+#include "common_variable_8x8_sprite_font.h"
+
+int main()
+{
+    bn::core::init();
+    ldtk::core::init();
+
+    constexpr bn::string_view info_text_lines[] = {
+        "PAD: move camera",
+        "B (held): move camera fast",
+        "A: go to next level",
+        "R: jump to the opposite side",
+    };
+
+    bn::sprite_text_generator big_text_generator(common::variable_8x16_sprite_font);
+    common::info info("Stress level bgs", info_text_lines, big_text_generator);
+
+    bn::sprite_text_generator small_text_generator(common::variable_8x8_sprite_font);
+    common::stats stats(small_text_generator);
+
+#if LDTK_CFG_STATS_ENABLED
+    // Shows the update cost, and the cells rewritten by each layer in the worst frame of every second
+    stats.set_mode(common::stats::mode_type::LEVEL_BGS);
+#endif
+
+    bn::camera_ptr camera = bn::camera_ptr::create();
+
+    // Synthetic levels of every grid size, cell storage & flip density (`tools/benchmarks/synthetic_ldtk.py`)
+    const bn::span<const ldtk::level>& levels = ldtk::gen::gen_project.levels();
+    int level_index = 0;
+
+    ldtk::level_bgs_ptr level_bgs = levels[level_index].create_bgs();
+    level_bgs.set_camera(camera);
+
+    while (true)
+    {
+        if (bn::keypad::a_pressed())
+        {
+            // Reloads all the cells of all the layer bgs
+            level_index = (level_index + 1) % levels.size();
+            level_bgs.set_level(levels[level_index]);
+            camera.set_position(0, 0);
+        }
+
+        if (bn::keypad::r_pressed())
+        {
+            // Moves more than a screen, which also reloads all the cells
+            camera.set_position(-camera.position());
+        }
+
+        // 32px streams 4 columns or rows per frame
+        const bn::fixed camera_move_speed = bn::keypad::b_held() ? 32 : 4;
+
+        if (bn::keypad::left_held())
+            camera.set_x(camera.x() - camera_move_speed);
+        if (bn::keypad::right_held())
+            camera.set_x(camera.x() + camera_move_speed);
+        if (bn::keypad::up_held())
+            camera.set_y(camera.y() - camera_move_speed);
+        if (bn::keypad::down_held())
+            camera.set_y(camera.y() + camera_move_speed);
+
+        info.update();
+        stats.update();
+        bn::core::update();
+    }
+}
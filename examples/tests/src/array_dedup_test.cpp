@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "ldtk_gen_project.h"
+
+template <typename Elem>
+[[nodiscard]] constexpr auto same_array(const ldtk::entity& e1, const ldtk::entity& e2,
+                                        ldtk::gen::entity_field_ident field_ident) -> bool
+{
+    const auto arr1 = e1.get_field(field_ident).get<bn::span<const Elem>>();
+    const auto arr2 = e2.get_field(field_ident).get<bn::span<const Elem>>();
+    return arr1.size() != 0 && arr1.size() == arr2.size() && arr1.data() == arr2.data();
+}
+
+[[nodiscard]] constexpr auto same_arrays(const ldtk::entity& e1, const ldtk::entity& e2) -> bool
+{
+    using ef_id = ldtk::gen::entity_field_ident;
+
+    return same_array<std::int32_t>(e1, e2, ef_id::ENTITY_entity_FIELD_int_arr) &&
+           same_array<std::uint8_t>(e1, e2, ef_id::ENTITY_entity_FIELD_u8_arr) &&
+           same_array<bn::fixed>(e1, e2, ef_id::ENTITY_entity_FIELD_float_arr) &&
+           same_array<bn::string_view>(e1, e2, ef_id::ENTITY_entity_FIELD_string_arr) &&
+           same_array<bn::color>(e1, e2, ef_id::ENTITY_entity_FIELD_color_arr) &&
+           same_array<bn::point>(e1, e2, ef_id::ENTITY_entity_FIELD_point_arr);
+}
+
+// Identical arrays in the same level
+static_assert([] {
+    const auto& level = ldtk::gen::gen_project.get_level(ldtk::gen::level_ident::level_0);
+    const auto& entities_layer = level.get_layer(ldtk::gen::layer_ident::entities);
+    const auto& green_sq = entities_layer.find_entity(ldtk::gen::entity_iid::_fefb7d50_8560_11f0_8a9b_6da874eeb8b3);
+    const auto& green_sq_copy =
+        entities_layer.find_entity(ldtk::gen::entity_iid::_3c1d84a0_8561_11f0_8a9b_2f7e5d9c0b41);
+
+    return same_arrays(green_sq, green_sq_copy);
+}());
+
+// Identical arrays across levels
+static_assert([] {
+    const auto& level_0 = ldtk::gen::gen_project.get_level(ldtk::gen::level_ident::level_0);
+    const auto& level_1 = ldtk::gen::gen_project.get_level(ldtk::gen::level_ident::level_1);
+    const auto& green_sq = level_0.get_layer(ldtk::gen::layer_ident::entities)
+                               .find_entity(ldtk::gen::entity_iid::_fefb7d50_8560_11f0_8a9b_6da874eeb8b3);
+    const auto& level_1_green_sq = level_1.get_layer(ldtk::gen::layer_ident::entities)
+                                       .find_entity(ldtk::gen::entity_iid::_5e0cc931_8561_11f0_8a9b_38c9d6e0f2a4);
+
+    return same_arrays(green_sq, level_1_green_sq);
+}());
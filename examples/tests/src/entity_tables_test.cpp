@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "ldtk_gen_project.h"
+
+static_assert([] {
+    const auto& level = ldtk::gen::gen_project.get_level(ldtk::gen::level_ident::level_0);
+    const auto& entities_layer = level.get_layer(ldtk::gen::layer_ident::entities);
+    const ldtk::entity_table* table = entities_layer.entity_table();
+
+    if (table == nullptr || table->size() != entities_layer.entity_instances().size())
+        return false;
+
+    for (int i = 0; i < table->size(); ++i)
+    {
+        const ldtk::entity& et = entities_layer.entity_instances()[i];
+        const ldtk::entity_table::row row = (*table)[i];
+
+        if (row.identifier() != et.identifier() || table->identifiers()[i] != et.identifier() ||
+            row.px() != et.px() || table->px_x()[i] != et.px().x() || table->px_y()[i] != et.px().y() ||
+            row.size() != et.size() || row.field_instances().data() != et.field_instances().data() ||
+            &row.instance() != &et)
+            return false;
+    }
+
+    return true;
+}());
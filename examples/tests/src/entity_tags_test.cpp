@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "ldtk_gen_project.h"
+
+using namespace ldtk::gen;
+
+// Tag values are sorted, regardless of the order in the LDtk project
+static_assert(static_cast<int>(entity_tag::enemy) == 0);
+static_assert(static_cast<int>(entity_tag::solid) == 1);
+
+static_assert(ldtk::tag_mask(entity_tag::enemy) == 0b01);
+static_assert(ldtk::tag_mask(entity_tag::solid, entity_tag::enemy) == 0b11);
+
+static_assert([] {
+    const auto& level = gen_project.get_level(level_ident::level_0);
+    const auto& entities_layer = level.get_layer(layer_ident::entities);
+
+    for (const ldtk::entity& entity : entities_layer.entity_instances())
+    {
+        if (entity.def().tag_mask() != ldtk::tag_mask(entity_tag::enemy, entity_tag::solid))
+            return false;
+        if (!entity.has_tag(entity_tag::enemy) || !entity.has_tag(entity_tag::solid))
+            return false;
+        if (!entity.has_any_tags(ldtk::tag_mask(entity_tag::solid)) ||
+            !entity.has_all_tags(ldtk::tag_mask(entity_tag::enemy, entity_tag::solid)))
+            return false;
+        if (entity.has_any_tags(0) || !entity.has_all_tags(0))
+            return false;
+    }
+
+    return true;
+}());
+
+static_assert([] {
+    const auto& level = gen_project.get_level(level_ident::level_0);
+    const auto& entities_layer = level.get_layer(layer_ident::entities);
+    const auto& tiles_layer = level.get_layer(layer_ident::tiles);
+
+    if (!entities_layer.has_entity_tag_index() || !tiles_layer.has_entity_tag_index())
+        return false;
+
+    const bn::span<const ldtk::entity* const>& enemies = entities_layer.tagged_entities(entity_tag::enemy);
+    if (enemies.size() != entities_layer.entity_instances().size())
+        return false;
+
+    for (int i = 0; i < enemies.size(); ++i)
+        if (enemies[i] != &entities_layer.entity_instances()[i] || !enemies[i]->has_tag(entity_tag::enemy))
+            return false;
+
+    return tiles_layer.tagged_entities(entity_tag::solid).empty();
+}());
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "ldtk_spatial_hash.h"
+
+#include "ldtk_gen_project.h"
+
+#include <cstdint>
+
+namespace
+{
+
+constexpr int RANDOM_ACTORS_COUNT = 48;
+
+struct random_generator
+{
+    std::uint32_t state;
+
+    constexpr auto next(int limit) -> int
+    {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<int>((state >> 16) % static_cast<std::uint32_t>(limit));
+    }
+};
+
+constexpr auto random_rect(random_generator& random) -> bn::top_left_fixed_rect
+{
+    return bn::top_left_fixed_rect(random.next(320) - 64, random.next(240) - 64, 1 + random.next(30),
+                                   1 + random.next(30));
+}
+
+// Compares the pairs & queries of the spatial hash with the brute-force ones.
+template <int BucketSize>
+constexpr auto matches_brute_force(std::uint32_t seed) -> bool
+{
+    random_generator random{seed};
+    ldtk::spatial_hash<RANDOM_ACTORS_COUNT, RANDOM_ACTORS_COUNT * 16> hash(BucketSize);
+    bn::top_left_fixed_rect rects[RANDOM_ACTORS_COUNT];
+
+    for (bn::top_left_fixed_rect& rect : rects)
+    {
+        rect = random_rect(random);
+        hash.insert(rect);
+    }
+
+    // Move some of them around
+    for (int i = 0; i < RANDOM_ACTORS_COUNT; i += 3)
+    {
+        rects[i] = random_rect(random);
+        hash.update(i, rects[i]);
+    }
+
+    bool reported[RANDOM_ACTORS_COUNT][RANDOM_ACTORS_COUNT] = {};
+    bool duplicated = false;
+    hash.for_each_pair([&](int a, int b) {
+        duplicated = duplicated || reported[a][b] || reported[b][a];
+        reported[a][b] = true;
+    });
+    if (duplicated)
+        return false;
+
+    for (int a = 0; a < RANDOM_ACTORS_COUNT; ++a)
+        for (int b = a + 1; b < RANDOM_ACTORS_COUNT; ++b)
+            if (rects[a].intersects(rects[b]) != (reported[a][b] || reported[b][a]))
+                return false;
+
+    for (int q = 0; q < 8; ++q)
+    {
+        const bn::top_left_fixed_rect query_rect = random_rect(random);
+        int found[RANDOM_ACTORS_COUNT] = {};
+        hash.query(query_rect, [&](int id) { ++found[id]; });
+
+        for (int i = 0; i < RANDOM_ACTORS_COUNT; ++i)
+            if (found[i] != (rects[i].intersects(query_rect) ? 1 : 0))
+                return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+static_assert(matches_brute_force<16>(1));
+static_assert(matches_brute_force<16>(2));
+static_assert(matches_brute_force<8>(3));
+static_assert(matches_brute_force<12>(4));
+
+static_assert([] {
+    ldtk::spatial_hash<4> hash(16);
+
+    const int a = hash.insert(bn::top_left_fixed_rect(0, 0, 16, 16));
+    const int b = hash.insert(bn::top_left_fixed_rect(8, 8, 16, 16));
+    const int c = hash.insert(bn::top_left_fixed_rect(100, 100, 8, 8));
+    if (hash.size() != 3)
+        return false;
+
+    int pairs = 0;
+    hash.for_each_pair([&](int x, int y) {
+        if ((x == a && y == b) || (x == b && y == a))
+            ++pairs;
+        else
+            pairs += 100;
+    });
+    if (pairs != 1)
+        return false;
+
+    // Move `c` over `a`, and erase `b`
+    hash.update(c, bn::fixed_point(4, 4));
+    hash.erase(b);
+
+    pairs = 0;
+    hash.for_each_pair([&](int x, int y) {
+        if ((x == a && y == c) || (x == c && y == a))
+            ++pairs;
+        else
+            pairs += 100;
+    });
+    if (pairs != 1 || hash.size() != 2)
+        return false;
+
+    // Erased slot is reused
+    return hash.insert(bn::top_left_fixed_rect(0, 0, 1, 1)) == b;
+}());
+
+static_assert([] {
+    const auto& level = ldtk::gen::gen_project.get_level(ldtk::gen::level_ident::level_0);
+    const auto& entities_layer = level.get_layer(ldtk::gen::layer_ident::entities);
+
+    ldtk::spatial_hash<8> hash(entities_layer);
+    if (hash.bucket_size() != entities_layer.grid_size())
+        return false;
+
+    for (const ldtk::entity& entity : entities_layer.entity_instances())
+    {
+        const bn::top_left_fixed_rect& rect = hash.rect(hash.insert(entity));
+
+        if (rect.x() != entity.px().x() - entity.width() * entity.pivot().x() ||
+            rect.y() != entity.px().y() - entity.height() * entity.pivot().y() || rect.width() != entity.width() ||
+            rect.height() != entity.height())
+            return false;
+    }
+
+    return hash.size() == entities_layer.entity_instances().size();
+}());
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "ldtk_gen_project.h"
+#include "ldtk_gen_stats.h"
+
+#include <bn_math.h>
+
+using namespace ldtk::gen;
+
+// Precomputed maxima must be the same as scanning all the levels
+static_assert(stats::levels_count == gen_project.levels().size());
+
+static_assert([] {
+    int max_px_width = 0, max_px_height = 0, max_bg_layers = 0;
+
+    for (const ldtk::level& level : gen_project.levels())
+    {
+        max_px_width = bn::max(max_px_width, level.px_width());
+        max_px_height = bn::max(max_px_height, level.px_height());
+
+        int bg_layers = 0;
+        for (const ldtk::layer& layer : level.layer_instances())
+            if (layer.auto_layer_tiles() || layer.grid_tiles())
+                ++bg_layers;
+        max_bg_layers = bn::max(max_bg_layers, bg_layers);
+    }
+
+    return max_px_width == stats::max_level_px_width && max_px_height == stats::max_level_px_height &&
+           max_bg_layers == stats::max_bg_layers_per_level;
+}());
+
+static_assert([] {
+    int max_per_level = 0, max_per_layer = 0, max_int_grid_value = 0;
+
+    for (const ldtk::level& level : gen_project.levels())
+    {
+        int level_count = 0;
+        for (const ldtk::layer& layer : level.layer_instances())
+        {
+            for (const ldtk::entity& entity : layer.entity_instances())
+                if (entity.identifier() == entity_ident::entity)
+                    ++level_count;
+
+            if (layer.identifier() == layer_ident::entities)
+                max_per_layer = bn::max(max_per_layer, layer.entity_instances().size());
+
+            if (layer.identifier() == layer_ident::intgrid && layer.int_grid())
+            {
+                const ldtk::int_grid_base& grid = *layer.int_grid();
+                for (int y = 0; y < grid.c_height(); ++y)
+                    for (int x = 0; x < grid.c_width(); ++x)
+                        max_int_grid_value = bn::max(max_int_grid_value, grid.cell_int(x, y));
+            }
+        }
+        max_per_level = bn::max(max_per_level, level_count);
+    }
+
+    return max_per_level == stats::max_entities_per_level(entity_ident::entity) &&
+           max_per_layer == stats::max_entities_per_layer(layer_ident::entities) &&
+           max_per_layer == stats::max_entities_per_layer(layer_ident::entities, entity_ident::entity) &&
+           max_int_grid_value == stats::max_int_grid_value(layer_ident::intgrid);
+}());
+
+static_assert([] {
+    int max_tile_cell_bytes = 0, max_int_grid_cell_bytes = 0;
+
+    for (const ldtk::level& level : gen_project.levels())
+    {
+        const ldtk::layer& tiles_layer = level.get_layer(layer_ident::tiles);
+        const ldtk::tile_grid_base* tiles =
+            tiles_layer.auto_layer_tiles() ? tiles_layer.auto_layer_tiles() : tiles_layer.grid_tiles();
+        if (tiles)
+            max_tile_cell_bytes = bn::max(max_tile_cell_bytes, tiles->bloated() ? 2 : 1);
+
+        const ldtk::layer& int_grid_layer = level.get_layer(layer_ident::intgrid);
+        if (int_grid_layer.int_grid())
+            max_int_grid_cell_bytes = bn::max(max_int_grid_cell_bytes, int_grid_layer.int_grid()->cell_storage_size());
+    }
+
+    return max_tile_cell_bytes == stats::max_tile_cell_bytes(layer_ident::tiles) &&
+           max_int_grid_cell_bytes == stats::max_int_grid_cell_bytes(layer_ident::intgrid);
+}());
+
+// Layers without the cells are `0`
+static_assert(stats::max_tile_cell_bytes(layer_ident::entities) == 0);
+static_assert(stats::max_int_grid_cell_bytes(layer_ident::entities) == 0);
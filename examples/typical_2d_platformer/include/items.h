@@ -6,7 +6,7 @@
 #include "item.h"
 
 #include "ldtk_gen_idents.h"
-#include "ldtk_gen_project.h"
+#include "ldtk_gen_stats.h"
 
 #include <bn_vector.h>
 
@@ -31,8 +31,9 @@ public:
     void update();
 
 private:
+    // Most items in the entities layer of a level
     static constexpr int MAX_ITEMS_COUNT =
-        ldtk::gen::gen_project.defs().get_entity_def(ldtk::gen::entity_ident::item).max_count();
+        ldtk::gen::stats::max_entities_per_layer(ldtk::gen::layer_ident::entities, ldtk::gen::entity_ident::item);
 
     bn::vector<item, MAX_ITEMS_COUNT> _items;
 };
@@ -5,6 +5,9 @@
 
 #include "mob.h"
 
+#include "ldtk_gen_idents.h"
+#include "ldtk_gen_stats.h"
+
 #include <bn_vector.h>
 
 namespace ldtk
@@ -28,7 +31,9 @@ public:
     void update();
 
 private:
-    static constexpr int MAX_MOBS_COUNT = 16;
+    // Most mobs in the entities layer of a level
+    static constexpr int MAX_MOBS_COUNT =
+        ldtk::gen::stats::max_entities_per_layer(ldtk::gen::layer_ident::entities, ldtk::gen::entity_ident::mob);
 
     bn::vector<mob, MAX_MOBS_COUNT> _mobs;
 };
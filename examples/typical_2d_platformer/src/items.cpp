@@ -17,27 +17,6 @@ void items::load_from_level(const ldtk::level& level, const bn::camera_ptr& came
 {
     _items.clear();
 
-    // Compile-time check to ensure there are up to `MAX_ITEMS_COUNT` items in all levels
-    static_assert(
-        [] {
-            for (const ldtk::level& lv : ldtk::gen::gen_project.levels())
-            {
-                const ldtk::layer& ent_layer = lv.get_layer(ldtk::gen::layer_ident::entities);
-                int item_count = 0;
-
-                for (const ldtk::entity& ent : ent_layer.entity_instances())
-                {
-                    if (ent.identifier() == ldtk::gen::entity_ident::item)
-                    {
-                        if (++item_count > MAX_ITEMS_COUNT)
-                            return false;
-                    }
-                }
-            }
-            return true;
-        }(),
-        "Too many items exist in a level");
-
     const ldtk::layer& entities_layer = level.get_layer(ldtk::gen::layer_ident::entities);
     for (const ldtk::entity& entity : entities_layer.entity_instances())
     {
@@ -19,27 +19,6 @@ void mobs::load_from_level(const ldtk::level& level, const bn::camera_ptr& camer
 {
     _mobs.clear();
 
-    // Compile-time check to ensure there are up to `MAX_MOBS_COUNT` mobs in all levels
-    static_assert(
-        [] {
-            for (const ldtk::level& lv : ldtk::gen::gen_project.levels())
-            {
-                const ldtk::layer& ent_layer = lv.get_layer(ldtk::gen::layer_ident::entities);
-                int item_count = 0;
-
-                for (const ldtk::entity& ent : ent_layer.entity_instances())
-                {
-                    if (ent.identifier() == ldtk::gen::entity_ident::mob)
-                    {
-                        if (++item_count > MAX_MOBS_COUNT)
-                            return false;
-                    }
-                }
-            }
-            return true;
-        }(),
-        "Too many mobs exist in a level");
-
     const ldtk::layer& entities_layer = level.get_layer(ldtk::gen::layer_ident::entities);
     for (const ldtk::entity& entity : entities_layer.entity_instances())
     {
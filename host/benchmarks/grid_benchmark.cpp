@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "host_benchmark.h"
+
+#include "ldtk_gen_project.h"
+#include "ldtk_tile_grid_t.h"
+
+// Reads of every cell of the tile grids, through the virtual functions and the non-virtual ones.
+
+namespace
+{
+
+template <typename Read>
+void read_all_tile_grids(Read&& read)
+{
+    for (const ldtk::level& level : ldtk::gen::gen_project.levels())
+    {
+        for (const ldtk::layer& layer : level.layer_instances())
+        {
+            if (const ldtk::tile_grid_base* grid = layer.auto_layer_tiles())
+                read(*grid);
+            if (const ldtk::tile_grid_base* grid = layer.grid_tiles())
+                read(*grid);
+        }
+    }
+}
+
+} // namespace
+
+HOST_BENCHMARK(tile_grid_read_virtual)
+{
+    state.measure([] {
+        read_all_tile_grids([](const ldtk::tile_grid_base& grid) {
+            for (int y = 0; y < grid.c_height(); ++y)
+                for (int x = 0; x < grid.c_width(); ++x)
+                    host_benchmark::do_not_optimize(grid.cell_tile_info(x, y));
+        });
+    });
+}
+
+HOST_BENCHMARK(tile_grid_read_no_virtual)
+{
+    state.measure([] {
+        read_all_tile_grids([](const ldtk::tile_grid_base& grid) {
+            for (int y = 0; y < grid.c_height(); ++y)
+            {
+                for (int x = 0; x < grid.c_width(); ++x)
+                {
+                    if (grid.bloated())
+                        host_benchmark::do_not_optimize(
+                            static_cast<const ldtk::tile_grid_t<true>&>(grid).cell_tile_info_no_virtual(x, y));
+                    else
+                        host_benchmark::do_not_optimize(
+                            static_cast<const ldtk::tile_grid_t<false>&>(grid).cell_tile_info_no_virtual(x, y));
+                }
+            }
+        });
+    });
+}
+
+HOST_BENCHMARK(int_grid_read)
+{
+    state.measure([] {
+        for (const ldtk::level& level : ldtk::gen::gen_project.levels())
+        {
+            for (const ldtk::layer& layer : level.layer_instances())
+            {
+                if (const ldtk::int_grid_base* grid = layer.int_grid())
+                {
+                    for (int y = 0; y < grid->c_height(); ++y)
+                        for (int x = 0; x < grid->c_width(); ++x)
+                            host_benchmark::do_not_optimize(grid->cell_int(x, y));
+                }
+            }
+        }
+    });
+}
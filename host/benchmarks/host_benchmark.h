@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Minimal micro-benchmark harness of the host build.
+//
+// `HOST_BENCHMARK(name)` registers a benchmark, which runs its body `iterations` times inside `state.measure()`.
+// Benchmarks measuring the time by themselves report it with `state.add_elapsed()` instead.
+// Host timings don't translate to the GBA cycles, so compare them only with the other runs on the same machine.
+
+namespace host_benchmark
+{
+
+class state
+{
+public:
+    explicit state(int iterations) : _iterations(iterations)
+    {
+    }
+
+    [[nodiscard]] int iterations() const
+    {
+        return _iterations;
+    }
+
+    // Measures `iterations()` calls of `function`.
+    template <typename Function>
+    void measure(Function&& function)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (int iteration = 0; iteration < _iterations; ++iteration)
+            function();
+
+        _elapsed += std::chrono::steady_clock::now() - start;
+    }
+
+    void add_elapsed(std::chrono::nanoseconds elapsed)
+    {
+        _elapsed += elapsed;
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds elapsed() const
+    {
+        return _elapsed;
+    }
+
+    // Number of the items processed in all iterations (e.g. streamed cells), to report the time per item.
+    void set_items(std::int64_t items)
+    {
+        _items = items;
+    }
+
+    [[nodiscard]] std::int64_t items() const
+    {
+        return _items;
+    }
+
+private:
+    int _iterations;
+    std::chrono::nanoseconds _elapsed{};
+    std::int64_t _items = 0;
+};
+
+using benchmark_function = std::function<void(state&)>;
+
+struct benchmark
+{
+    std::string name;
+    benchmark_function function;
+};
+
+inline auto benchmarks() -> std::vector<benchmark>&
+{
+    static std::vector<benchmark> registered;
+    return registered;
+}
+
+inline void register_benchmark(std::string name, benchmark_function function)
+{
+    benchmarks().push_back(benchmark{std::move(name), std::move(function)});
+}
+
+struct registrar
+{
+    registrar(const char* name, benchmark_function function)
+    {
+        register_benchmark(name, std::move(function));
+    }
+};
+
+// Keeps the compiler from optimizing away the computation of `value`.
+template <typename Type>
+void do_not_optimize(const Type& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+} // namespace host_benchmark
+
+#define HOST_BENCHMARK(name)                                                                                           \
+    static void name(host_benchmark::state&);                                                                          \
+    static const host_benchmark::registrar name##_registrar(#name, name);                                              \
+    static void name(host_benchmark::state& state)
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "host_benchmark.h"
+
+#include "ldtk_core.h"
+
+#include <bn_core.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// Usage: host_benchmarks [--iterations N] [name filter]
+int main(int argc, char* argv[])
+{
+    int iterations = 100000;
+    const char* filter = nullptr;
+
+    for (int arg_idx = 1; arg_idx < argc; ++arg_idx)
+    {
+        if (std::strcmp(argv[arg_idx], "--iterations") == 0 && arg_idx + 1 < argc)
+            iterations = std::atoi(argv[++arg_idx]);
+        else
+            filter = argv[arg_idx];
+    }
+
+    if (iterations <= 0)
+    {
+        std::cerr << "Invalid iterations: " << iterations << '\n';
+        return 1;
+    }
+
+    bn::core::init();
+    ldtk::core::init();
+
+    for (const host_benchmark::benchmark& benchmark : host_benchmark::benchmarks())
+    {
+        if (filter && benchmark.name.find(filter) == std::string::npos)
+            continue;
+
+        host_benchmark::state state(iterations);
+        benchmark.function(state);
+
+        const double ns_per_iteration = double(state.elapsed().count()) / state.iterations();
+        std::cout << std::left << std::setw(56) << benchmark.name << std::right << std::setw(12) << std::fixed
+                  << std::setprecision(1) << ns_per_iteration << " ns/iter";
+
+        if (state.items() > 0)
+        {
+            const double ns_per_item = double(state.elapsed().count()) / state.items();
+            std::cout << std::setw(10) << std::setprecision(2) << ns_per_item << " ns/item";
+        }
+
+        std::cout << "  (" << state.iterations() << " iterations)\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "host_benchmark.h"
+
+#include "ldtk_gen_project.h"
+#include "ldtk_level_bgs_ptr.h"
+#include "ldtk_level_bgs_stats.h"
+
+#include <bn_core.h>
+
+// Measures the uninstrumented streaming; The stats are covered by the platformer tests.
+static_assert(!LDTK_CFG_STATS_ENABLED);
+
+// Frame update of `level_bgs_manager` on the biggest level of `typical_2d_platformer`,
+// which streams the map cells of every background.
+
+namespace
+{
+
+auto biggest_level() -> const ldtk::level&
+{
+    const ldtk::level* result = &ldtk::gen::gen_project.levels()[0];
+
+    for (const ldtk::level& level : ldtk::gen::gen_project.levels())
+    {
+        if (level.px_width() * level.px_height() > result->px_width() * result->px_height())
+            result = &level;
+    }
+
+    return *result;
+}
+
+// Scrolls back and forth by `step` each frame, so that it stays inside the level.
+void scroll_benchmark(host_benchmark::state& state, const bn::fixed_point& step)
+{
+    const ldtk::level& level = biggest_level();
+    ldtk::level_bgs_ptr level_bgs = level.create_bgs(0, 0);
+    bn::core::update();
+
+    int frame = 0;
+    bn::fixed_point direction = step;
+
+    state.measure([&] {
+        if (++frame % 64 == 0)
+            direction = -direction;
+
+        level_bgs.set_position(level_bgs.position() + direction);
+        bn::core::update();
+    });
+}
+
+} // namespace
+
+HOST_BENCHMARK(level_bgs_idle)
+{
+    ldtk::level_bgs_ptr level_bgs = biggest_level().create_bgs(0, 0);
+    bn::core::update();
+
+    state.measure([] { bn::core::update(); });
+}
+
+HOST_BENCHMARK(level_bgs_scroll_horizontal_1px)
+{
+    scroll_benchmark(state, bn::fixed_point(1, 0));
+}
+
+HOST_BENCHMARK(level_bgs_scroll_vertical_1px)
+{
+    scroll_benchmark(state, bn::fixed_point(0, 1));
+}
+
+HOST_BENCHMARK(level_bgs_scroll_diagonal_8px)
+{
+    scroll_benchmark(state, bn::fixed_point(8, 8));
+}
+
+HOST_BENCHMARK(level_bgs_full_reload)
+{
+    ldtk::level_bgs_ptr level_bgs = biggest_level().create_bgs(0, 0);
+    bn::core::update();
+
+    // Moving over the screen size reloads all the cells
+    bn::fixed direction = 256;
+
+    state.measure([&] {
+        direction = -direction;
+        level_bgs.set_x(level_bgs.x() + direction);
+        bn::core::update();
+    });
+}
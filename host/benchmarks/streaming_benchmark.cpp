@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "host_benchmark.h"
+
+#include "streaming_benchmark.h"
+
+#include "ldtk_gen_project.h"
+
+#include <chrono>
+#include <string>
+
+// Registers `streaming_benchmark` for every level x camera path of the project this is linked with.
+// An iteration is a frame, and an item is a streamed cell.
+
+namespace
+{
+
+struct host_clock
+{
+    std::chrono::steady_clock::time_point start;
+
+    void restart()
+    {
+        start = std::chrono::steady_clock::now();
+    }
+
+    auto elapsed() const -> std::int64_t
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+};
+
+auto level_name(int level_index, const ldtk::level& level) -> std::string
+{
+    const streaming_benchmark::level_info info = streaming_benchmark::get_level_info(level);
+
+    std::string result = "level_";
+    result += std::to_string(level_index);
+    result += "_g";
+    result += std::to_string(info.min_grid_size);
+    if (info.max_grid_size != info.min_grid_size)
+    {
+        result += '-';
+        result += std::to_string(info.max_grid_size);
+    }
+
+    result += info.bloated ? "_u16" : "_u8";
+    result += "_flip";
+    result += std::to_string(info.flip_percent);
+    result += "_x";
+    result += std::to_string(info.bgs_count);
+    if (info.smaller_than_screen)
+        result += "_oob";
+
+    return result;
+}
+
+const bool registered = [] {
+    int level_index = 0;
+
+    for (const ldtk::level& level : ldtk::gen::gen_project.levels())
+    {
+        const std::string name = "streaming/" + level_name(level_index++, level) + "/";
+
+        for (streaming_benchmark::camera_path path : streaming_benchmark::camera_paths)
+        {
+            host_benchmark::register_benchmark(
+                name + std::string(streaming_benchmark::camera_path_name(path)),
+                [&level, path](host_benchmark::state& state) {
+                    host_clock clock;
+                    const streaming_benchmark::result result =
+                        streaming_benchmark::run(level, path, state.iterations(), clock);
+
+                    state.add_elapsed(std::chrono::nanoseconds(result.elapsed));
+                    state.set_items(result.cells);
+                });
+        }
+    }
+
+    return true;
+}();
+
+} // namespace
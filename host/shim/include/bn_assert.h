@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include <cstdlib>
+#include <iostream>
+
+// Unlike Butano, assertions are always enabled on the host, as they're what the tests are for.
+
+#define BN_ASSERT(condition, ...) \
+    do \
+    { \
+        if (!(condition)) [[unlikely]] \
+            ::bn::assert::show(#condition, __FILE__, __LINE__ __VA_OPT__(, ) __VA_ARGS__); \
+    } while (false)
+
+#define BN_BASIC_ASSERT(condition, ...) BN_ASSERT(condition __VA_OPT__(, ) __VA_ARGS__)
+
+#define BN_ERROR(...) ::bn::assert::show("", __FILE__, __LINE__ __VA_OPT__(, ) __VA_ARGS__)
+
+namespace bn::assert
+{
+
+template <typename... Args>
+[[noreturn]] void show(const char* condition, const char* file_name, int line, const Args&... args)
+{
+    std::cerr << file_name << ':' << line << ": ASSERT FAILED: " << condition << "\n    ";
+    (
+        [&](const auto& arg) {
+            if constexpr (requires { std::cerr << arg; })
+                std::cerr << arg;
+            else
+                std::cerr << '?';
+        }(args),
+        ...);
+    std::cerr << std::endl;
+    std::abort();
+}
+
+} // namespace bn::assert
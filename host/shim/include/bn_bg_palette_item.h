@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_bpp_mode.h"
+#include "bn_color.h"
+#include "bn_span.h"
+
+namespace bn
+{
+
+class bg_palette_ptr;
+
+class bg_palette_item
+{
+public:
+    constexpr bg_palette_item(const span<const color>& colors_ref, bpp_mode bpp) : _colors_ref(colors_ref), _bpp(bpp)
+    {
+    }
+
+    [[nodiscard]] constexpr const span<const color>& colors_ref() const
+    {
+        return _colors_ref;
+    }
+
+    [[nodiscard]] constexpr bpp_mode bpp() const
+    {
+        return _bpp;
+    }
+
+    [[nodiscard]] bg_palette_ptr create_palette() const;
+
+    [[nodiscard]] constexpr friend bool operator==(const bg_palette_item& a, const bg_palette_item& b)
+    {
+        return a._colors_ref.data() == b._colors_ref.data() && a._colors_ref.size() == b._colors_ref.size() &&
+               a._bpp == b._bpp;
+    }
+
+private:
+    span<const color> _colors_ref;
+    bpp_mode _bpp;
+};
+
+} // namespace bn
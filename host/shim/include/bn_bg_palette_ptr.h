@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_bg_palette_item.h"
+
+namespace bn
+{
+
+// There's no palette RAM on the host, so it only refers to the colors of the item.
+class bg_palette_ptr
+{
+public:
+    [[nodiscard]] static bg_palette_ptr create(const bg_palette_item& palette_item)
+    {
+        return bg_palette_ptr(palette_item);
+    }
+
+    [[nodiscard]] const span<const color>& colors() const
+    {
+        return _item.colors_ref();
+    }
+
+    [[nodiscard]] bpp_mode bpp() const
+    {
+        return _item.bpp();
+    }
+
+    [[nodiscard]] friend bool operator==(const bg_palette_ptr& a, const bg_palette_ptr& b) = default;
+
+private:
+    bg_palette_item _item;
+
+    explicit bg_palette_ptr(const bg_palette_item& palette_item) : _item(palette_item)
+    {
+    }
+};
+
+inline bg_palette_ptr bg_palette_item::create_palette() const
+{
+    return bg_palette_ptr::create(*this);
+}
+
+} // namespace bn
@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+namespace bn::bgs
+{
+
+[[nodiscard]] constexpr int min_priority()
+{
+    return 0;
+}
+
+[[nodiscard]] constexpr int max_priority()
+{
+    return 3;
+}
+
+[[nodiscard]] constexpr int min_z_order()
+{
+    return -32767;
+}
+
+[[nodiscard]] constexpr int max_z_order()
+{
+    return 32767;
+}
+
+[[nodiscard]] int used_items_count();
+
+[[nodiscard]] int available_items_count();
+
+} // namespace bn::bgs
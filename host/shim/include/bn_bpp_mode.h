@@ -0,0 +1,17 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include <cstdint>
+
+namespace bn
+{
+
+enum class bpp_mode : std::uint8_t
+{
+    BPP_4,
+    BPP_8,
+};
+
+} // namespace bn
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include <cstdint>
+
+namespace bn
+{
+
+class color
+{
+public:
+    constexpr color() = default;
+
+    constexpr color(int red, int green, int blue) : _data(std::uint16_t(red | (green << 5) | (blue << 10)))
+    {
+    }
+
+    [[nodiscard]] constexpr int red() const
+    {
+        return _data & 31;
+    }
+
+    [[nodiscard]] constexpr int green() const
+    {
+        return (_data >> 5) & 31;
+    }
+
+    [[nodiscard]] constexpr int blue() const
+    {
+        return (_data >> 10) & 31;
+    }
+
+    [[nodiscard]] constexpr int data() const
+    {
+        return _data;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(const color& a, const color& b) = default;
+
+private:
+    std::uint16_t _data = 0;
+};
+
+} // namespace bn
@@ -0,0 +1,14 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+// Host shim of Butano, which only has what butano-ldtk uses.
+// Memory sections don't exist on the host, so their attributes are empty.
+
+#include <cstdint>
+
+#define BN_CODE_IWRAM
+#define BN_CODE_EWRAM
+#define BN_DATA_EWRAM
+#define BN_DATA_EWRAM_BSS
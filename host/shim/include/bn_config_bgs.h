@@ -0,0 +1,8 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#ifndef BN_CFG_BGS_MAX_ITEMS
+    #define BN_CFG_BGS_MAX_ITEMS 4
+#endif
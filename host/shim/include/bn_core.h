@@ -0,0 +1,20 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+namespace bn::core
+{
+
+using update_callback_type = void (*)();
+
+void init();
+
+// There's no VBlank to wait for on the host, so it only calls the update callback.
+void update();
+
+[[nodiscard]] update_callback_type update_callback();
+
+void set_update_callback(update_callback_type update_callback);
+
+} // namespace bn::core
@@ -0,0 +1,19 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+namespace bn::display
+{
+
+[[nodiscard]] constexpr int width()
+{
+    return 240;
+}
+
+[[nodiscard]] constexpr int height()
+{
+    return 160;
+}
+
+} // namespace bn::display
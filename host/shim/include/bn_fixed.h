@@ -0,0 +1,186 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <ostream>
+
+namespace bn
+{
+
+template <int Precision>
+class fixed_t
+{
+    static_assert(Precision > 0 && Precision < 31);
+
+public:
+    [[nodiscard]] static constexpr int precision()
+    {
+        return Precision;
+    }
+
+    [[nodiscard]] static constexpr int scale()
+    {
+        return 1 << Precision;
+    }
+
+    [[nodiscard]] static constexpr fixed_t from_data(int data)
+    {
+        fixed_t result;
+        result._data = data;
+        return result;
+    }
+
+    constexpr fixed_t() = default;
+
+    constexpr fixed_t(int value) : _data(value << Precision)
+    {
+    }
+
+    template <std::floating_point Type>
+    constexpr fixed_t(Type value) : _data(int(value * scale()))
+    {
+    }
+
+    [[nodiscard]] constexpr int data() const
+    {
+        return _data;
+    }
+
+    [[nodiscard]] constexpr int integer() const
+    {
+        return _data / scale();
+    }
+
+    [[nodiscard]] constexpr int right_shift_integer() const
+    {
+        return _data >> Precision;
+    }
+
+    [[nodiscard]] constexpr int floor_integer() const
+    {
+        return _data >> Precision;
+    }
+
+    [[nodiscard]] constexpr int round_integer() const
+    {
+        return (_data + (scale() / 2)) >> Precision;
+    }
+
+    [[nodiscard]] constexpr int ceil_integer() const
+    {
+        return (_data + scale() - 1) >> Precision;
+    }
+
+    [[nodiscard]] constexpr fixed_t fraction() const
+    {
+        return from_data(_data & (scale() - 1));
+    }
+
+    [[nodiscard]] constexpr float to_float() const
+    {
+        return float(_data) / scale();
+    }
+
+    [[nodiscard]] constexpr fixed_t multiplication(fixed_t other) const
+    {
+        return from_data(int((std::int64_t(_data) * other._data) >> Precision));
+    }
+
+    [[nodiscard]] constexpr fixed_t division(fixed_t other) const
+    {
+        return from_data(int((std::int64_t(_data) << Precision) / other._data));
+    }
+
+    [[nodiscard]] constexpr fixed_t operator-() const
+    {
+        return from_data(-_data);
+    }
+
+    constexpr fixed_t& operator+=(fixed_t other)
+    {
+        _data += other._data;
+        return *this;
+    }
+
+    constexpr fixed_t& operator-=(fixed_t other)
+    {
+        _data -= other._data;
+        return *this;
+    }
+
+    constexpr fixed_t& operator*=(int value)
+    {
+        _data *= value;
+        return *this;
+    }
+
+    constexpr fixed_t& operator*=(fixed_t other)
+    {
+        *this = multiplication(other);
+        return *this;
+    }
+
+    constexpr fixed_t& operator/=(int value)
+    {
+        _data /= value;
+        return *this;
+    }
+
+    constexpr fixed_t& operator/=(fixed_t other)
+    {
+        *this = division(other);
+        return *this;
+    }
+
+    [[nodiscard]] constexpr friend fixed_t operator+(fixed_t a, fixed_t b)
+    {
+        return a += b;
+    }
+
+    [[nodiscard]] constexpr friend fixed_t operator-(fixed_t a, fixed_t b)
+    {
+        return a -= b;
+    }
+
+    [[nodiscard]] constexpr friend fixed_t operator*(fixed_t a, int b)
+    {
+        return a *= b;
+    }
+
+    [[nodiscard]] constexpr friend fixed_t operator*(int a, fixed_t b)
+    {
+        return b *= a;
+    }
+
+    [[nodiscard]] constexpr friend fixed_t operator*(fixed_t a, fixed_t b)
+    {
+        return a *= b;
+    }
+
+    [[nodiscard]] constexpr friend fixed_t operator/(fixed_t a, int b)
+    {
+        return a /= b;
+    }
+
+    [[nodiscard]] constexpr friend fixed_t operator/(fixed_t a, fixed_t b)
+    {
+        return a /= b;
+    }
+
+    [[nodiscard]] constexpr friend auto operator<=>(const fixed_t& a, const fixed_t& b) = default;
+
+    friend std::ostream& operator<<(std::ostream& stream, fixed_t value)
+    {
+        return stream << value.to_float();
+    }
+
+private:
+    int _data = 0;
+};
+
+using fixed = fixed_t<12>;
+
+} // namespace bn
@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_fixed.h"
+#include "bn_fixed_point_fwd.h"
+#include "bn_point.h"
+
+namespace bn
+{
+
+template <int Precision>
+class fixed_point_t
+{
+public:
+    constexpr fixed_point_t() = default;
+
+    constexpr fixed_point_t(fixed_t<Precision> x, fixed_t<Precision> y) : _x(x), _y(y)
+    {
+    }
+
+    constexpr fixed_point_t(const point& point) : _x(point.x()), _y(point.y())
+    {
+    }
+
+    [[nodiscard]] constexpr fixed_t<Precision> x() const
+    {
+        return _x;
+    }
+
+    constexpr void set_x(fixed_t<Precision> x)
+    {
+        _x = x;
+    }
+
+    [[nodiscard]] constexpr fixed_t<Precision> y() const
+    {
+        return _y;
+    }
+
+    constexpr void set_y(fixed_t<Precision> y)
+    {
+        _y = y;
+    }
+
+    [[nodiscard]] constexpr fixed_point_t operator-() const
+    {
+        return fixed_point_t(-_x, -_y);
+    }
+
+    constexpr fixed_point_t& operator+=(const fixed_point_t& other)
+    {
+        _x += other._x;
+        _y += other._y;
+        return *this;
+    }
+
+    constexpr fixed_point_t& operator-=(const fixed_point_t& other)
+    {
+        _x -= other._x;
+        _y -= other._y;
+        return *this;
+    }
+
+    constexpr fixed_point_t& operator*=(int value)
+    {
+        _x *= value;
+        _y *= value;
+        return *this;
+    }
+
+    constexpr fixed_point_t& operator*=(fixed_t<Precision> value)
+    {
+        _x *= value;
+        _y *= value;
+        return *this;
+    }
+
+    constexpr fixed_point_t& operator/=(int value)
+    {
+        _x /= value;
+        _y /= value;
+        return *this;
+    }
+
+    constexpr fixed_point_t& operator/=(fixed_t<Precision> value)
+    {
+        _x /= value;
+        _y /= value;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr friend fixed_point_t operator+(fixed_point_t a, const fixed_point_t& b)
+    {
+        return a += b;
+    }
+
+    [[nodiscard]] constexpr friend fixed_point_t operator-(fixed_point_t a, const fixed_point_t& b)
+    {
+        return a -= b;
+    }
+
+    [[nodiscard]] constexpr friend fixed_point_t operator*(fixed_point_t a, int b)
+    {
+        return a *= b;
+    }
+
+    [[nodiscard]] constexpr friend fixed_point_t operator*(fixed_point_t a, fixed_t<Precision> b)
+    {
+        return a *= b;
+    }
+
+    [[nodiscard]] constexpr friend fixed_point_t operator/(fixed_point_t a, int b)
+    {
+        return a /= b;
+    }
+
+    [[nodiscard]] constexpr friend fixed_point_t operator/(fixed_point_t a, fixed_t<Precision> b)
+    {
+        return a /= b;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(const fixed_point_t& a, const fixed_point_t& b) = default;
+
+private:
+    fixed_t<Precision> _x;
+    fixed_t<Precision> _y;
+};
+
+} // namespace bn
@@ -0,0 +1,14 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+namespace bn
+{
+
+template <int Precision>
+class fixed_point_t;
+
+using fixed_point = fixed_point_t<12>;
+
+} // namespace bn
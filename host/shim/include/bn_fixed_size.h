@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_fixed.h"
+
+namespace bn
+{
+
+class fixed_size
+{
+public:
+    constexpr fixed_size() = default;
+
+    constexpr fixed_size(fixed width, fixed height) : _width(width), _height(height)
+    {
+    }
+
+    [[nodiscard]] constexpr fixed width() const
+    {
+        return _width;
+    }
+
+    [[nodiscard]] constexpr fixed height() const
+    {
+        return _height;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(const fixed_size& a, const fixed_size& b) = default;
+
+private:
+    fixed _width;
+    fixed _height;
+};
+
+} // namespace bn
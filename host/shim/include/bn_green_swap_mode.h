@@ -0,0 +1,18 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include <cstdint>
+
+namespace bn
+{
+
+enum class green_swap_mode : std::uint8_t
+{
+    DEFAULT,
+    ENABLED,
+    DISABLED,
+};
+
+} // namespace bn
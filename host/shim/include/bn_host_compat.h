@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+// Force-included into every host source, to fill in what the host's standard library lacks.
+
+#include <algorithm>
+#include <functional>
+#include <version>
+
+#ifndef __cpp_lib_ranges_contains
+
+namespace std::ranges
+{
+
+struct __host_contains_fn
+{
+    template <input_range Range, typename Type, typename Proj = identity>
+    [[nodiscard]] constexpr bool operator()(Range&& range, const Type& value, Proj proj = {}) const
+    {
+        return ranges::find(range, value, std::ref(proj)) != ranges::end(range);
+    }
+};
+
+inline constexpr __host_contains_fn contains{};
+
+} // namespace std::ranges
+
+#endif
@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+namespace bn
+{
+
+template <typename Type>
+[[nodiscard]] constexpr Type abs(Type value)
+{
+    return value < Type(0) ? -value : value;
+}
+
+template <typename Type>
+[[nodiscard]] constexpr const Type& min(const Type& a, const Type& b)
+{
+    return b < a ? b : a;
+}
+
+template <typename Type>
+[[nodiscard]] constexpr const Type& max(const Type& a, const Type& b)
+{
+    return a < b ? b : a;
+}
+
+} // namespace bn
@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include <optional>
+#include <utility>
+
+namespace bn
+{
+
+using nullopt_t = std::nullopt_t;
+
+inline constexpr nullopt_t nullopt = std::nullopt;
+
+template <typename Type>
+class optional : public std::optional<Type>
+{
+public:
+    using std::optional<Type>::optional;
+
+    // Forwarded instead of `using`, which is ambiguous with the implicit copy assignment for values
+    template <typename Other>
+    constexpr optional& operator=(Other&& other)
+    {
+        std::optional<Type>::operator=(std::forward<Other>(other));
+        return *this;
+    }
+
+    [[nodiscard]] constexpr const Type* get() const
+    {
+        return this->has_value() ? &**this : nullptr;
+    }
+
+    [[nodiscard]] constexpr Type* get()
+    {
+        return this->has_value() ? &**this : nullptr;
+    }
+};
+
+} // namespace bn
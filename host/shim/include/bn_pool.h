@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_assert.h"
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace bn
+{
+
+// Fixed size storage like Butano's, so that the benchmarks don't measure the heap allocator.
+template <typename Type, int MaxSize>
+class pool
+{
+    static_assert(MaxSize > 0);
+
+public:
+    pool()
+    {
+        for (int index = 0; index < MaxSize; ++index)
+            _free_indexes[index] = MaxSize - 1 - index;
+    }
+
+    pool(const pool&) = delete;
+    pool& operator=(const pool&) = delete;
+
+    [[nodiscard]] int size() const
+    {
+        return MaxSize - _free_count;
+    }
+
+    [[nodiscard]] static constexpr int max_size()
+    {
+        return MaxSize;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return _free_count == MaxSize;
+    }
+
+    [[nodiscard]] bool full() const
+    {
+        return _free_count == 0;
+    }
+
+    template <typename... Args>
+    [[nodiscard]] Type& create(Args&&... args)
+    {
+        BN_ASSERT(!full(), "Pool is full");
+
+        const int index = _free_indexes[--_free_count];
+        return *::new (static_cast<void*>(_buffer + (index * sizeof(Type)))) Type(std::forward<Args>(args)...);
+    }
+
+    void destroy(Type& value)
+    {
+        const auto offset = reinterpret_cast<std::byte*>(&value) - _buffer;
+        BN_ASSERT(offset >= 0 && offset < std::ptrdiff_t(sizeof(_buffer)), "Value is not in this pool");
+
+        value.~Type();
+        _free_indexes[_free_count++] = int(offset / std::ptrdiff_t(sizeof(Type)));
+    }
+
+private:
+    alignas(Type) std::byte _buffer[sizeof(Type) * MaxSize];
+    int _free_indexes[MaxSize];
+    int _free_count = MaxSize;
+};
+
+} // namespace bn
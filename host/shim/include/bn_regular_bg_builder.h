@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_regular_bg_ptr.h"
+
+namespace bn
+{
+
+class regular_bg_builder
+{
+public:
+    explicit regular_bg_builder(const regular_bg_item& item) : _item(item)
+    {
+    }
+
+    [[nodiscard]] const regular_bg_item& item() const
+    {
+        return _item;
+    }
+
+    [[nodiscard]] const fixed_point& position() const
+    {
+        return _position;
+    }
+
+    regular_bg_builder& set_position(const fixed_point& position)
+    {
+        _position = position;
+        return *this;
+    }
+
+    regular_bg_builder& set_priority(int priority)
+    {
+        _priority = priority;
+        return *this;
+    }
+
+    regular_bg_builder& set_z_order(int z_order)
+    {
+        _z_order = z_order;
+        return *this;
+    }
+
+    regular_bg_builder& set_mosaic_enabled(bool mosaic_enabled)
+    {
+        _mosaic_enabled = mosaic_enabled;
+        return *this;
+    }
+
+    regular_bg_builder& set_blending_top_enabled(bool blending_top_enabled)
+    {
+        _blending_top_enabled = blending_top_enabled;
+        return *this;
+    }
+
+    regular_bg_builder& set_blending_bottom_enabled(bool blending_bottom_enabled)
+    {
+        _blending_bottom_enabled = blending_bottom_enabled;
+        return *this;
+    }
+
+    regular_bg_builder& set_green_swap_mode(bn::green_swap_mode green_swap_mode)
+    {
+        _green_swap_mode = green_swap_mode;
+        return *this;
+    }
+
+    regular_bg_builder& set_visible(bool visible)
+    {
+        _visible = visible;
+        return *this;
+    }
+
+    [[nodiscard]] regular_bg_ptr build() const;
+
+    [[nodiscard]] regular_bg_ptr release_build()
+    {
+        return build();
+    }
+
+private:
+    regular_bg_item _item;
+    fixed_point _position;
+    int _priority = 3;
+    int _z_order = 0;
+    bool _mosaic_enabled = false;
+    bool _blending_top_enabled = false;
+    bool _blending_bottom_enabled = false;
+    bn::green_swap_mode _green_swap_mode = bn::green_swap_mode::DEFAULT;
+    bool _visible = true;
+};
+
+} // namespace bn
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_bg_palette_item.h"
+#include "bn_regular_bg_map_item.h"
+#include "bn_regular_bg_tiles_item.h"
+
+namespace bn
+{
+
+class regular_bg_item
+{
+public:
+    constexpr regular_bg_item(const regular_bg_tiles_item& tiles_item, const bg_palette_item& palette_item,
+                              const regular_bg_map_item& map_item)
+        : _tiles_item(tiles_item), _palette_item(palette_item), _map_item(map_item)
+    {
+    }
+
+    [[nodiscard]] constexpr const regular_bg_tiles_item& tiles_item() const
+    {
+        return _tiles_item;
+    }
+
+    [[nodiscard]] constexpr const bg_palette_item& palette_item() const
+    {
+        return _palette_item;
+    }
+
+    [[nodiscard]] constexpr const regular_bg_map_item& map_item() const
+    {
+        return _map_item;
+    }
+
+private:
+    regular_bg_tiles_item _tiles_item;
+    bg_palette_item _palette_item;
+    regular_bg_map_item _map_item;
+};
+
+} // namespace bn
@@ -0,0 +1,13 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include <cstdint>
+
+namespace bn
+{
+
+using regular_bg_map_cell = std::uint16_t;
+
+} // namespace bn
@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_regular_bg_map_cell.h"
+
+namespace bn
+{
+
+class regular_bg_map_cell_info
+{
+public:
+    constexpr regular_bg_map_cell_info() = default;
+
+    constexpr explicit regular_bg_map_cell_info(regular_bg_map_cell cell) : _cell(cell)
+    {
+    }
+
+    [[nodiscard]] constexpr int tile_index() const
+    {
+        return _cell & 0x3FF;
+    }
+
+    constexpr void set_tile_index(int tile_index)
+    {
+        _cell = regular_bg_map_cell((_cell & ~0x3FF) | tile_index);
+    }
+
+    [[nodiscard]] constexpr bool horizontal_flip() const
+    {
+        return _cell & 0x400;
+    }
+
+    constexpr void set_horizontal_flip(bool horizontal_flip)
+    {
+        _cell = regular_bg_map_cell(horizontal_flip ? (_cell | 0x400) : (_cell & ~0x400));
+    }
+
+    [[nodiscard]] constexpr bool vertical_flip() const
+    {
+        return _cell & 0x800;
+    }
+
+    constexpr void set_vertical_flip(bool vertical_flip)
+    {
+        _cell = regular_bg_map_cell(vertical_flip ? (_cell | 0x800) : (_cell & ~0x800));
+    }
+
+    [[nodiscard]] constexpr int palette_id() const
+    {
+        return _cell >> 12;
+    }
+
+    constexpr void set_palette_id(int palette_id)
+    {
+        _cell = regular_bg_map_cell((_cell & 0x0FFF) | (palette_id << 12));
+    }
+
+    [[nodiscard]] constexpr regular_bg_map_cell cell() const
+    {
+        return _cell;
+    }
+
+private:
+    regular_bg_map_cell _cell = 0;
+};
+
+} // namespace bn
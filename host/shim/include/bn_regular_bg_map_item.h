@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_assert.h"
+#include "bn_regular_bg_map_cell.h"
+#include "bn_size.h"
+
+namespace bn
+{
+
+class regular_bg_map_item
+{
+public:
+    constexpr regular_bg_map_item(const regular_bg_map_cell& cells_ref, const size& dimensions)
+        : _cells_ptr(&cells_ref), _dimensions(dimensions)
+    {
+    }
+
+    [[nodiscard]] constexpr const regular_bg_map_cell* cells_ptr() const
+    {
+        return _cells_ptr;
+    }
+
+    [[nodiscard]] constexpr const size& dimensions() const
+    {
+        return _dimensions;
+    }
+
+    [[nodiscard]] constexpr int cell_index(int x, int y) const
+    {
+        BN_ASSERT(x >= 0 && x < _dimensions.width(), "Invalid x: ", x);
+        BN_ASSERT(y >= 0 && y < _dimensions.height(), "Invalid y: ", y);
+
+        return (y * _dimensions.width()) + x;
+    }
+
+    [[nodiscard]] constexpr regular_bg_map_cell cell(int x, int y) const
+    {
+        return _cells_ptr[cell_index(x, y)];
+    }
+
+private:
+    const regular_bg_map_cell* _cells_ptr;
+    size _dimensions;
+};
+
+} // namespace bn
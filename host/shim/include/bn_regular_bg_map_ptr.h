@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_optional.h"
+#include "bn_regular_bg_map_cell.h"
+#include "bn_size.h"
+#include "bn_span.h"
+
+#include <memory>
+
+namespace bn
+{
+
+namespace host
+{
+
+struct regular_bg_state;
+
+} // namespace host
+
+class regular_bg_map_ptr
+{
+public:
+    [[nodiscard]] size dimensions() const;
+
+    [[nodiscard]] optional<span<const regular_bg_map_cell>> cells_ref() const;
+
+    // There's no VRAM on the host, so it only counts the reloads.
+    void reload_cells_ref();
+
+    [[nodiscard]] friend bool operator==(const regular_bg_map_ptr& a, const regular_bg_map_ptr& b) = default;
+
+private:
+    friend class regular_bg_ptr;
+
+    std::shared_ptr<host::regular_bg_state> _state;
+
+    explicit regular_bg_map_ptr(std::shared_ptr<host::regular_bg_state> state) : _state(std::move(state))
+    {
+    }
+};
+
+} // namespace bn
@@ -0,0 +1,211 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_bg_palette_ptr.h"
+#include "bn_fixed_point.h"
+#include "bn_green_swap_mode.h"
+#include "bn_regular_bg_item.h"
+#include "bn_regular_bg_map_ptr.h"
+#include "bn_window.h"
+
+#include <memory>
+#include <vector>
+
+namespace bn
+{
+
+class regular_bg_builder;
+
+namespace host
+{
+
+// Every attribute of a background, which would be committed to the hardware registers by Butano.
+struct regular_bg_state
+{
+    regular_bg_item item;
+    bg_palette_ptr palette;
+    fixed_point position;
+    int priority = 3;
+    int z_order = 0;
+    int order = 0;
+    bool mosaic_enabled = false;
+    bool blending_top_enabled = false;
+    bool blending_bottom_enabled = false;
+    bn::green_swap_mode green_swap_mode = bn::green_swap_mode::DEFAULT;
+    bool visible = true;
+    bool visible_in_windows[window::count()] = {true, true, true, true};
+    int cells_reloads = 0;
+
+    explicit regular_bg_state(const regular_bg_item& item_);
+    ~regular_bg_state();
+
+    regular_bg_state(const regular_bg_state&) = delete;
+    regular_bg_state& operator=(const regular_bg_state&) = delete;
+};
+
+// Host only; Every alive background, in the creation order.
+[[nodiscard]] auto regular_bgs() -> const std::vector<const regular_bg_state*>&;
+
+} // namespace host
+
+class regular_bg_ptr
+{
+public:
+    [[nodiscard]] static regular_bg_ptr create(const regular_bg_item& item)
+    {
+        return regular_bg_ptr(std::make_shared<host::regular_bg_state>(item));
+    }
+
+    [[nodiscard]] fixed x() const
+    {
+        return _state->position.x();
+    }
+
+    void set_x(fixed x)
+    {
+        _state->position.set_x(x);
+    }
+
+    [[nodiscard]] fixed y() const
+    {
+        return _state->position.y();
+    }
+
+    void set_y(fixed y)
+    {
+        _state->position.set_y(y);
+    }
+
+    [[nodiscard]] const fixed_point& position() const
+    {
+        return _state->position;
+    }
+
+    void set_position(fixed x, fixed y)
+    {
+        _state->position = fixed_point(x, y);
+    }
+
+    void set_position(const fixed_point& position)
+    {
+        _state->position = position;
+    }
+
+    [[nodiscard]] int priority() const
+    {
+        return _state->priority;
+    }
+
+    void set_priority(int priority);
+
+    [[nodiscard]] int z_order() const
+    {
+        return _state->z_order;
+    }
+
+    void set_z_order(int z_order);
+
+    void put_above();
+
+    void put_below();
+
+    [[nodiscard]] bool mosaic_enabled() const
+    {
+        return _state->mosaic_enabled;
+    }
+
+    void set_mosaic_enabled(bool mosaic_enabled)
+    {
+        _state->mosaic_enabled = mosaic_enabled;
+    }
+
+    [[nodiscard]] bool blending_top_enabled() const
+    {
+        return _state->blending_top_enabled;
+    }
+
+    void set_blending_top_enabled(bool blending_top_enabled)
+    {
+        _state->blending_top_enabled = blending_top_enabled;
+    }
+
+    [[nodiscard]] bool blending_bottom_enabled() const
+    {
+        return _state->blending_bottom_enabled;
+    }
+
+    void set_blending_bottom_enabled(bool blending_bottom_enabled)
+    {
+        _state->blending_bottom_enabled = blending_bottom_enabled;
+    }
+
+    [[nodiscard]] bn::green_swap_mode green_swap_mode() const
+    {
+        return _state->green_swap_mode;
+    }
+
+    void set_green_swap_mode(bn::green_swap_mode green_swap_mode)
+    {
+        _state->green_swap_mode = green_swap_mode;
+    }
+
+    [[nodiscard]] bool visible() const
+    {
+        return _state->visible;
+    }
+
+    void set_visible(bool visible)
+    {
+        _state->visible = visible;
+    }
+
+    [[nodiscard]] bool visible_in_window(const window& window) const
+    {
+        return _state->visible_in_windows[window.id()];
+    }
+
+    void set_visible_in_window(bool visible, window& window)
+    {
+        _state->visible_in_windows[window.id()] = visible;
+    }
+
+    [[nodiscard]] const bg_palette_ptr& palette() const
+    {
+        return _state->palette;
+    }
+
+    void set_palette(const bg_palette_ptr& palette)
+    {
+        _state->palette = palette;
+    }
+
+    void set_palette(bg_palette_ptr&& palette)
+    {
+        _state->palette = std::move(palette);
+    }
+
+    void set_palette(const bg_palette_item& palette_item)
+    {
+        _state->palette = palette_item.create_palette();
+    }
+
+    [[nodiscard]] regular_bg_map_ptr map() const
+    {
+        return regular_bg_map_ptr(_state);
+    }
+
+    [[nodiscard]] friend bool operator==(const regular_bg_ptr& a, const regular_bg_ptr& b) = default;
+
+private:
+    friend class regular_bg_builder;
+
+    std::shared_ptr<host::regular_bg_state> _state;
+
+    explicit regular_bg_ptr(std::shared_ptr<host::regular_bg_state> state) : _state(std::move(state))
+    {
+    }
+};
+
+} // namespace bn
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_bpp_mode.h"
+#include "bn_span.h"
+#include "bn_tile.h"
+
+namespace bn
+{
+
+class regular_bg_tiles_item
+{
+public:
+    constexpr regular_bg_tiles_item(const span<const tile>& tiles_ref, bpp_mode bpp)
+        : _tiles_ref(tiles_ref), _bpp(bpp)
+    {
+    }
+
+    [[nodiscard]] constexpr const span<const tile>& tiles_ref() const
+    {
+        return _tiles_ref;
+    }
+
+    [[nodiscard]] constexpr bpp_mode bpp() const
+    {
+        return _bpp;
+    }
+
+private:
+    span<const tile> _tiles_ref;
+    bpp_mode _bpp;
+};
+
+} // namespace bn
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+namespace bn
+{
+
+class size
+{
+public:
+    constexpr size() = default;
+
+    constexpr size(int width, int height) : _width(width), _height(height)
+    {
+    }
+
+    [[nodiscard]] constexpr int width() const
+    {
+        return _width;
+    }
+
+    constexpr void set_width(int width)
+    {
+        _width = width;
+    }
+
+    [[nodiscard]] constexpr int height() const
+    {
+        return _height;
+    }
+
+    constexpr void set_height(int height)
+    {
+        _height = height;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(const size& a, const size& b) = default;
+
+private:
+    int _width = 0;
+    int _height = 0;
+};
+
+} // namespace bn
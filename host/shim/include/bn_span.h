@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_assert.h"
+
+#include <iterator>
+#include <type_traits>
+
+namespace bn
+{
+
+template <typename Type>
+class span
+{
+public:
+    using element_type = Type;
+    using value_type = std::remove_cv_t<Type>;
+    using size_type = int;
+    using pointer = Type*;
+    using reference = Type&;
+    using iterator = Type*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    constexpr span() = default;
+
+    constexpr span(pointer data, size_type size) : _data(data), _size(size)
+    {
+        BN_ASSERT(size >= 0, "Invalid size: ", size);
+    }
+
+    constexpr span(pointer first, pointer last) : _data(first), _size(int(last - first))
+    {
+    }
+
+    template <int Size>
+    constexpr span(element_type (&array)[Size]) : _data(array), _size(Size)
+    {
+    }
+
+    template <typename OtherType>
+        requires(!std::is_same_v<OtherType, Type> && std::is_convertible_v<OtherType (*)[], Type (*)[]>)
+    constexpr span(const span<OtherType>& other) : _data(other.data()), _size(other.size())
+    {
+    }
+
+    [[nodiscard]] constexpr pointer data() const
+    {
+        return _data;
+    }
+
+    [[nodiscard]] constexpr size_type size() const
+    {
+        return _size;
+    }
+
+    [[nodiscard]] constexpr size_type size_bytes() const
+    {
+        return _size * int(sizeof(Type));
+    }
+
+    [[nodiscard]] constexpr bool empty() const
+    {
+        return _size == 0;
+    }
+
+    [[nodiscard]] constexpr iterator begin() const
+    {
+        return _data;
+    }
+
+    [[nodiscard]] constexpr iterator end() const
+    {
+        return _data + _size;
+    }
+
+    [[nodiscard]] constexpr reverse_iterator rbegin() const
+    {
+        return reverse_iterator(end());
+    }
+
+    [[nodiscard]] constexpr reverse_iterator rend() const
+    {
+        return reverse_iterator(begin());
+    }
+
+    [[nodiscard]] constexpr reference front() const
+    {
+        BN_ASSERT(_size > 0, "Span is empty");
+
+        return _data[0];
+    }
+
+    [[nodiscard]] constexpr reference back() const
+    {
+        BN_ASSERT(_size > 0, "Span is empty");
+
+        return _data[_size - 1];
+    }
+
+    [[nodiscard]] constexpr reference operator[](size_type index) const
+    {
+        BN_ASSERT(index >= 0 && index < _size, "Invalid index: ", index, " - ", _size);
+
+        return _data[index];
+    }
+
+    [[nodiscard]] constexpr span first(size_type count) const
+    {
+        BN_ASSERT(count >= 0 && count <= _size, "Invalid count: ", count, " - ", _size);
+
+        return span(_data, count);
+    }
+
+    [[nodiscard]] constexpr span last(size_type count) const
+    {
+        BN_ASSERT(count >= 0 && count <= _size, "Invalid count: ", count, " - ", _size);
+
+        return span(_data + _size - count, count);
+    }
+
+    [[nodiscard]] constexpr span subspan(size_type offset, size_type count) const
+    {
+        BN_ASSERT(offset >= 0 && count >= 0 && offset + count <= _size, "Invalid range: ", offset, " - ", count);
+
+        return span(_data + offset, count);
+    }
+
+private:
+    pointer _data = nullptr;
+    size_type _size = 0;
+};
+
+template <typename Type, int Size>
+span(Type (&)[Size]) -> span<Type>;
+
+} // namespace bn
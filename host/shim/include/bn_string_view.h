@@ -0,0 +1,13 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include <string_view>
+
+namespace bn
+{
+
+using string_view = std::string_view;
+
+} // namespace bn
@@ -0,0 +1,16 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include <cstdint>
+
+namespace bn
+{
+
+struct tile
+{
+    std::uint32_t data[8];
+};
+
+} // namespace bn
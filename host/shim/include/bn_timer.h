@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include <chrono>
+
+namespace bn
+{
+
+// Ticks at the GBA timer rate (2^24 Hz CPU clock / 64) from the host clock.
+class timer
+{
+public:
+    timer() : _start(std::chrono::steady_clock::now())
+    {
+    }
+
+    [[nodiscard]] int elapsed_ticks() const
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - _start;
+        return int(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() * TICKS_PER_SECOND /
+                   1'000'000'000);
+    }
+
+    void restart()
+    {
+        _start = std::chrono::steady_clock::now();
+    }
+
+    int elapsed_ticks_with_restart()
+    {
+        const int result = elapsed_ticks();
+        restart();
+        return result;
+    }
+
+private:
+    static constexpr long long TICKS_PER_SECOND = (1 << 24) / 64;
+
+    std::chrono::steady_clock::time_point _start;
+};
+
+} // namespace bn
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_fixed_point.h"
+#include "bn_fixed_size.h"
+
+namespace bn
+{
+
+class top_left_fixed_rect
+{
+public:
+    constexpr top_left_fixed_rect() = default;
+
+    constexpr top_left_fixed_rect(const fixed_point& position, const fixed_size& dimensions)
+        : _position(position), _dimensions(dimensions)
+    {
+    }
+
+    constexpr top_left_fixed_rect(fixed x, fixed y, fixed width, fixed height)
+        : _position(x, y), _dimensions(width, height)
+    {
+    }
+
+    [[nodiscard]] constexpr const fixed_point& position() const
+    {
+        return _position;
+    }
+
+    [[nodiscard]] constexpr const fixed_size& dimensions() const
+    {
+        return _dimensions;
+    }
+
+    [[nodiscard]] constexpr fixed x() const
+    {
+        return _position.x();
+    }
+
+    [[nodiscard]] constexpr fixed y() const
+    {
+        return _position.y();
+    }
+
+    [[nodiscard]] constexpr fixed width() const
+    {
+        return _dimensions.width();
+    }
+
+    [[nodiscard]] constexpr fixed height() const
+    {
+        return _dimensions.height();
+    }
+
+    [[nodiscard]] constexpr fixed left() const
+    {
+        return x();
+    }
+
+    [[nodiscard]] constexpr fixed right() const
+    {
+        return x() + width();
+    }
+
+    [[nodiscard]] constexpr fixed top() const
+    {
+        return y();
+    }
+
+    [[nodiscard]] constexpr fixed bottom() const
+    {
+        return y() + height();
+    }
+
+    [[nodiscard]] constexpr bool intersects(const top_left_fixed_rect& other) const
+    {
+        return left() < other.right() && right() > other.left() && top() < other.bottom() && bottom() > other.top();
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(const top_left_fixed_rect& a,
+                                                   const top_left_fixed_rect& b) = default;
+
+private:
+    fixed_point _position;
+    fixed_size _dimensions;
+};
+
+} // namespace bn
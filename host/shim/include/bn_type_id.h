@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+namespace bn
+{
+
+class type_id_t
+{
+public:
+    constexpr type_id_t() = default;
+
+    constexpr explicit type_id_t(const void* id) : _id(id)
+    {
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(const type_id_t& a, const type_id_t& b) = default;
+
+private:
+    const void* _id = nullptr;
+};
+
+namespace priv
+{
+
+template <typename Type>
+inline constexpr char type_id_tag = 0;
+
+} // namespace priv
+
+template <typename Type>
+[[nodiscard]] constexpr type_id_t type_id()
+{
+    return type_id_t(&priv::type_id_tag<Type>);
+}
+
+} // namespace bn
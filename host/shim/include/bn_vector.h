@@ -0,0 +1,222 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "bn_assert.h"
+
+#include <algorithm>
+#include <iterator>
+#include <new>
+#include <utility>
+
+namespace bn
+{
+
+template <typename Type, int MaxSize>
+class vector
+{
+    static_assert(MaxSize > 0);
+
+public:
+    using value_type = Type;
+    using size_type = int;
+    using iterator = Type*;
+    using const_iterator = const Type*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    vector() = default;
+
+    vector(const vector& other)
+    {
+        for (const Type& value : other)
+            push_back(value);
+    }
+
+    vector& operator=(const vector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+
+            for (const Type& value : other)
+                push_back(value);
+        }
+
+        return *this;
+    }
+
+    ~vector()
+    {
+        clear();
+    }
+
+    [[nodiscard]] size_type size() const
+    {
+        return _size;
+    }
+
+    [[nodiscard]] static constexpr size_type max_size()
+    {
+        return MaxSize;
+    }
+
+    [[nodiscard]] size_type available() const
+    {
+        return MaxSize - _size;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return _size == 0;
+    }
+
+    [[nodiscard]] bool full() const
+    {
+        return _size == MaxSize;
+    }
+
+    [[nodiscard]] Type* data()
+    {
+        return std::launder(reinterpret_cast<Type*>(_buffer));
+    }
+
+    [[nodiscard]] const Type* data() const
+    {
+        return std::launder(reinterpret_cast<const Type*>(_buffer));
+    }
+
+    [[nodiscard]] iterator begin()
+    {
+        return data();
+    }
+
+    [[nodiscard]] iterator end()
+    {
+        return data() + _size;
+    }
+
+    [[nodiscard]] const_iterator begin() const
+    {
+        return data();
+    }
+
+    [[nodiscard]] const_iterator end() const
+    {
+        return data() + _size;
+    }
+
+    [[nodiscard]] reverse_iterator rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+    [[nodiscard]] reverse_iterator rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+    [[nodiscard]] const_reverse_iterator rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+    [[nodiscard]] const_reverse_iterator rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    [[nodiscard]] Type& operator[](size_type index)
+    {
+        BN_ASSERT(index >= 0 && index < _size, "Invalid index: ", index, " - ", _size);
+
+        return data()[index];
+    }
+
+    [[nodiscard]] const Type& operator[](size_type index) const
+    {
+        BN_ASSERT(index >= 0 && index < _size, "Invalid index: ", index, " - ", _size);
+
+        return data()[index];
+    }
+
+    [[nodiscard]] Type& front()
+    {
+        return (*this)[0];
+    }
+
+    [[nodiscard]] Type& back()
+    {
+        return (*this)[_size - 1];
+    }
+
+    void push_back(const Type& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(Type&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    Type& emplace_back(Args&&... args)
+    {
+        BN_ASSERT(!full(), "Vector is full");
+
+        Type* result = ::new (static_cast<void*>(data() + _size)) Type(std::forward<Args>(args)...);
+        ++_size;
+        return *result;
+    }
+
+    void pop_back()
+    {
+        BN_ASSERT(!empty(), "Vector is empty");
+
+        --_size;
+        data()[_size].~Type();
+    }
+
+    iterator erase(const_iterator position)
+    {
+        iterator result = begin() + (position - begin());
+        std::move(result + 1, end(), result);
+        pop_back();
+        return result;
+    }
+
+    void clear()
+    {
+        while (_size)
+            pop_back();
+    }
+
+private:
+    alignas(Type) std::byte _buffer[sizeof(Type) * MaxSize];
+    size_type _size = 0;
+};
+
+template <typename Type, int MaxSize, typename Value>
+int erase(vector<Type, MaxSize>& vector, const Value& value)
+{
+    int erased_count = 0;
+
+    for (auto it = vector.begin(); it != vector.end();)
+    {
+        if (*it == value)
+        {
+            it = vector.erase(it);
+            ++erased_count;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return erased_count;
+}
+
+} // namespace bn
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+namespace bn
+{
+
+class window
+{
+public:
+    [[nodiscard]] static constexpr int count()
+    {
+        return 4;
+    }
+
+    [[nodiscard]] static window outside()
+    {
+        return window(2);
+    }
+
+    [[nodiscard]] static window sprites()
+    {
+        return window(3);
+    }
+
+    [[nodiscard]] int id() const
+    {
+        return _id;
+    }
+
+    [[nodiscard]] friend bool operator==(const window& a, const window& b) = default;
+
+protected:
+    explicit window(int id) : _id(id)
+    {
+    }
+
+private:
+    int _id;
+};
+
+} // namespace bn
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include <bn_core.h>
+
+namespace bn::core
+{
+
+namespace
+{
+
+update_callback_type current_update_callback = nullptr;
+
+} // namespace
+
+void init()
+{
+    current_update_callback = nullptr;
+}
+
+void update()
+{
+    if (current_update_callback)
+        current_update_callback();
+}
+
+update_callback_type update_callback()
+{
+    return current_update_callback;
+}
+
+void set_update_callback(update_callback_type update_callback)
+{
+    current_update_callback = update_callback;
+}
+
+} // namespace bn::core
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include <bn_bgs.h>
+#include <bn_config_bgs.h>
+#include <bn_regular_bg_builder.h>
+#include <bn_regular_bg_map_ptr.h>
+#include <bn_regular_bg_ptr.h>
+
+#include <algorithm>
+
+namespace bn
+{
+
+namespace
+{
+
+std::vector<const host::regular_bg_state*> alive_regular_bgs;
+int next_order = 0;
+
+} // namespace
+
+namespace host
+{
+
+regular_bg_state::regular_bg_state(const regular_bg_item& item_)
+    : item(item_), palette(item_.palette_item().create_palette()), order(next_order++)
+{
+    BN_BASIC_ASSERT(bgs::available_items_count() > 0, "No more BG items available");
+
+    alive_regular_bgs.push_back(this);
+}
+
+regular_bg_state::~regular_bg_state()
+{
+    std::erase(alive_regular_bgs, this);
+}
+
+auto regular_bgs() -> const std::vector<const regular_bg_state*>&
+{
+    return alive_regular_bgs;
+}
+
+} // namespace host
+
+namespace bgs
+{
+
+int used_items_count()
+{
+    return int(alive_regular_bgs.size());
+}
+
+int available_items_count()
+{
+    return BN_CFG_BGS_MAX_ITEMS - used_items_count();
+}
+
+} // namespace bgs
+
+void regular_bg_ptr::set_priority(int priority)
+{
+    BN_ASSERT(priority >= bgs::min_priority() && priority <= bgs::max_priority(), "Invalid priority: ", priority);
+
+    _state->priority = priority;
+}
+
+void regular_bg_ptr::set_z_order(int z_order)
+{
+    BN_ASSERT(z_order >= bgs::min_z_order() && z_order <= bgs::max_z_order(), "Invalid z order: ", z_order);
+
+    _state->z_order = z_order;
+}
+
+void regular_bg_ptr::put_above()
+{
+    _state->order = next_order++;
+}
+
+void regular_bg_ptr::put_below()
+{
+    int min_order = _state->order;
+    for (const host::regular_bg_state* state : alive_regular_bgs)
+        min_order = std::min(min_order, state->order);
+
+    _state->order = min_order - 1;
+}
+
+size regular_bg_map_ptr::dimensions() const
+{
+    return _state->item.map_item().dimensions();
+}
+
+optional<span<const regular_bg_map_cell>> regular_bg_map_ptr::cells_ref() const
+{
+    const regular_bg_map_item& map_item = _state->item.map_item();
+    const size& map_dimensions = map_item.dimensions();
+
+    return span<const regular_bg_map_cell>(map_item.cells_ptr(), map_dimensions.width() * map_dimensions.height());
+}
+
+void regular_bg_map_ptr::reload_cells_ref()
+{
+    ++_state->cells_reloads;
+}
+
+regular_bg_ptr regular_bg_builder::build() const
+{
+    regular_bg_ptr result = regular_bg_ptr::create(_item);
+    result.set_position(_position);
+    result.set_priority(_priority);
+    result.set_z_order(_z_order);
+    result.set_mosaic_enabled(_mosaic_enabled);
+    result.set_blending_top_enabled(_blending_top_enabled);
+    result.set_blending_bottom_enabled(_blending_bottom_enabled);
+    result.set_green_swap_mode(_green_swap_mode);
+    result.set_visible(_visible);
+    return result;
+}
+
+} // namespace bn
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "host_test.h"
+
+#include "ldtk_gen_project.h"
+#include "ldtk_tile_grid_t.h"
+
+#include <bn_regular_bg_item.h>
+
+namespace
+{
+
+void check_tile_grid(const ldtk::layer& layer, const ldtk::tile_grid_base& grid)
+{
+    const ldtk::tileset_definition* tileset_def = layer.tileset_def();
+    HOST_CHECK(tileset_def);
+    if (!tileset_def)
+        return;
+
+    const int m_tile_cnt = layer.grid_size() >> 3;
+    const bn::size map_dimensions = tileset_def->bg_item().map_item().dimensions();
+    const int tileset_cells_count = map_dimensions.width() * map_dimensions.height();
+
+    for (int y = 0; y < grid.c_height(); ++y)
+    {
+        for (int x = 0; x < grid.c_width(); ++x)
+        {
+            const ldtk::tile_grid_base::tile_info info = grid.cell_tile_info(x, y);
+
+            HOST_CHECK(info.index == grid.cell_tile_index(x, y));
+            HOST_CHECK(info.x_flip == grid.cell_tile_x_flip(x, y));
+            HOST_CHECK(info.y_flip == grid.cell_tile_y_flip(x, y));
+
+            // `level_bgs_manager` reads the 8x8 cells of the tile straight out of the tileset map
+            // Tile index `0` is the empty tile, which isn't counted in `tiles_count()`
+            HOST_CHECK(info.index <= tileset_def->tiles_count());
+            HOST_CHECK((info.index + 1) * m_tile_cnt * m_tile_cnt <= tileset_cells_count);
+
+            if (grid.bloated())
+            {
+                const auto& bloated_grid = static_cast<const ldtk::tile_grid_t<true>&>(grid);
+                const ldtk::tile_grid_base::tile_info no_virtual_info = bloated_grid.cell_tile_info_no_virtual(x, y);
+                HOST_CHECK(no_virtual_info.index == info.index);
+                HOST_CHECK(no_virtual_info.x_flip == info.x_flip && no_virtual_info.y_flip == info.y_flip);
+            }
+            else
+            {
+                const auto& packed_grid = static_cast<const ldtk::tile_grid_t<false>&>(grid);
+                const ldtk::tile_grid_base::tile_info no_virtual_info = packed_grid.cell_tile_info_no_virtual(x, y);
+                HOST_CHECK(no_virtual_info.index == info.index);
+                HOST_CHECK(no_virtual_info.x_flip == info.x_flip && no_virtual_info.y_flip == info.y_flip);
+            }
+        }
+    }
+}
+
+} // namespace
+
+HOST_TEST(tile_grids_are_consistent)
+{
+    for (const ldtk::level& level : ldtk::gen::gen_project.levels())
+    {
+        for (const ldtk::layer& layer : level.layer_instances())
+        {
+            if (const ldtk::tile_grid_base* grid = layer.auto_layer_tiles())
+                check_tile_grid(layer, *grid);
+            if (const ldtk::tile_grid_base* grid = layer.grid_tiles())
+                check_tile_grid(layer, *grid);
+        }
+    }
+}
+
+HOST_TEST(int_grids_have_defined_values)
+{
+    for (const ldtk::level& level : ldtk::gen::gen_project.levels())
+    {
+        for (const ldtk::layer& layer : level.layer_instances())
+        {
+            const ldtk::int_grid_base* grid = layer.int_grid();
+            if (!grid)
+                continue;
+
+            for (int y = 0; y < grid->c_height(); ++y)
+            {
+                for (int x = 0; x < grid->c_width(); ++x)
+                {
+                    const int value = grid->cell_int(x, y);
+                    HOST_CHECK(value == 0 || layer.def().get_int_grid_value_info(value));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+// Minimal test harness of the host build.
+//
+// `HOST_TEST(name) { ... }` registers a test case, and `HOST_CHECK(condition)` fails it without stopping.
+
+namespace host_test
+{
+
+using test_function = void (*)();
+
+struct test_case
+{
+    const char* name;
+    test_function function;
+};
+
+inline auto test_cases() -> std::vector<test_case>&
+{
+    static std::vector<test_case> cases;
+    return cases;
+}
+
+inline int failed_checks = 0;
+
+struct registrar
+{
+    registrar(const char* name, test_function function)
+    {
+        test_cases().push_back(test_case{name, function});
+    }
+};
+
+inline void report_failure(const char* condition, const char* file, int line)
+{
+    ++failed_checks;
+    std::cerr << file << ':' << line << ": check failed: " << condition << '\n';
+}
+
+} // namespace host_test
+
+#define HOST_TEST(name)                                                                                                \
+    static void name();                                                                                                \
+    static const host_test::registrar name##_registrar(#name, name);                                                   \
+    static void name()
+
+#define HOST_CHECK(condition)                                                                                          \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(condition)) [[unlikely]]                                                                                 \
+            host_test::report_failure(#condition, __FILE__, __LINE__);                                                 \
+    } while (false)
@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "host_test.h"
+
+#include "ldtk_core.h"
+
+#include <bn_core.h>
+
+int main()
+{
+    bn::core::init();
+    ldtk::core::init();
+
+    int failed_tests = 0;
+
+    for (const host_test::test_case& test : host_test::test_cases())
+    {
+        const int prev_failed_checks = host_test::failed_checks;
+        test.function();
+
+        const bool passed = (host_test::failed_checks == prev_failed_checks);
+        failed_tests += !passed;
+        std::cout << (passed ? "[ PASS ] " : "[ FAIL ] ") << test.name << '\n';
+    }
+
+    std::cout << host_test::test_cases().size() - failed_tests << '/' << host_test::test_cases().size()
+              << " tests passed\n";
+
+    return failed_tests == 0 ? 0 : 1;
+}
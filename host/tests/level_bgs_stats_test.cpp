@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "host_test.h"
+
+#include "ldtk_core.h"
+#include "ldtk_gen_project.h"
+#include "ldtk_level_bgs_ptr.h"
+
+#include <bn_core.h>
+#include <bn_regular_bg_ptr.h>
+
+#include <algorithm>
+
+// The platformer tests link the project built again with `LDTK_CFG_STATS_ENABLED`.
+static_assert(LDTK_CFG_STATS_ENABLED);
+
+namespace
+{
+
+constexpr int SCREEN_CELLS = 31 * 21;
+constexpr int CANVAS_BYTES = 32 * 32 * 2;
+
+auto bgs_count() -> int
+{
+    return int(bn::host::regular_bgs().size());
+}
+
+// Checks every layer of the last frame was fully reloaded for the `reason`.
+void check_last_frame_reloaded(ldtk::reload_reason reason)
+{
+    const ldtk::frame_stats& frame = ldtk::core::stats().frame(0);
+
+    HOST_CHECK(frame.reloads == bgs_count());
+    HOST_CHECK(frame.cells == SCREEN_CELLS * bgs_count());
+    HOST_CHECK(frame.vram_bytes == CANVAS_BYTES * bgs_count());
+    HOST_CHECK(frame.layers.size() == bgs_count());
+
+    for (const ldtk::layer_frame_stats& layer : frame.layers)
+    {
+        HOST_CHECK(layer.cells == SCREEN_CELLS);
+        HOST_CHECK(layer.reload && *layer.reload == reason);
+    }
+}
+
+} // namespace
+
+HOST_TEST(level_bgs_stats_count_the_streamed_cells)
+{
+    ldtk::core::reset_stats();
+
+    const ldtk::level& level = ldtk::gen::gen_project.levels()[0];
+    ldtk::level_bgs_ptr level_bgs = level.create_bgs(0, 0);
+    bn::core::update();
+    check_last_frame_reloaded(ldtk::reload_reason::SET_LEVEL);
+
+    // Nothing to stream
+    bn::core::update();
+    HOST_CHECK(ldtk::core::stats().frame(0).cells == 0);
+    HOST_CHECK(ldtk::core::stats().frame(0).vram_bytes == 0);
+    HOST_CHECK(ldtk::core::stats().frame(0).reloads == 0);
+
+    // A column & a row
+    level_bgs.set_position(level_bgs.position() + bn::fixed_point(8, 8));
+    bn::core::update();
+    for (const ldtk::layer_frame_stats& layer : ldtk::core::stats().frame(0).layers)
+    {
+        HOST_CHECK(layer.cells == 31 + 20);
+        HOST_CHECK(!layer.reload);
+    }
+    HOST_CHECK(ldtk::core::stats().frame(0).vram_bytes == CANVAS_BYTES * bgs_count());
+
+    level_bgs.set_position(level_bgs.position() + bn::fixed_point(400, 0));
+    bn::core::update();
+    check_last_frame_reloaded(ldtk::reload_reason::BIG_JUMP);
+
+    level_bgs.set_visible(false);
+    bn::core::update();
+    HOST_CHECK(ldtk::core::stats().frame(0).cells == 0);
+    level_bgs.set_visible(true);
+    bn::core::update();
+    check_last_frame_reloaded(ldtk::reload_reason::VISIBILITY);
+
+    const ldtk::total_stats& total = ldtk::core::stats().total();
+    HOST_CHECK(total.frames == 6);
+    HOST_CHECK(total.cells == (SCREEN_CELLS * 3 + 31 + 20) * bgs_count());
+    HOST_CHECK(total.reloads[int(ldtk::reload_reason::SET_LEVEL)] == bgs_count());
+    HOST_CHECK(total.reloads[int(ldtk::reload_reason::FORCE_RELOAD)] == 0);
+    HOST_CHECK(total.reloads[int(ldtk::reload_reason::BIG_JUMP)] == bgs_count());
+    HOST_CHECK(total.reloads[int(ldtk::reload_reason::VISIBILITY)] == bgs_count());
+    HOST_CHECK(total.max_update_cycles >= 0 && total.update_cycles >= total.max_update_cycles);
+}
+
+HOST_TEST(level_bgs_stats_count_the_vram_commits_without_cells)
+{
+    const ldtk::level& level = ldtk::gen::gen_project.levels()[0];
+    ldtk::level_bgs_ptr level_bgs = level.create_bgs(0, 0);
+    bn::core::update();
+    ldtk::core::reset_stats();
+
+    // A pixel per frame: Only a frame of a cell rewrites a column, but every frame commits the whole canvas
+    int frames_without_cells = 0;
+    for (int frame = 0; frame < 8; ++frame)
+    {
+        level_bgs.set_x(level_bgs.x() + 1);
+        bn::core::update();
+        frames_without_cells += ldtk::core::stats().frame(0).cells == 0;
+        HOST_CHECK(ldtk::core::stats().frame(0).vram_bytes == CANVAS_BYTES * bgs_count());
+    }
+    HOST_CHECK(frames_without_cells == 7);
+    HOST_CHECK(ldtk::core::stats().total().vram_bytes == 8 * CANVAS_BYTES * bgs_count());
+}
+
+HOST_TEST(level_bgs_stats_count_the_forced_reloads)
+{
+    const ldtk::level& level = ldtk::gen::gen_project.levels()[0];
+    ldtk::level_bgs_ptr level_bgs = level.create_bgs(0, 0);
+    bn::core::update();
+    const ldtk::frame_stats first_frame = ldtk::core::stats().frame(0);
+    ldtk::core::reset_stats();
+
+    for (const ldtk::layer_frame_stats& layer : first_frame.layers)
+    {
+        ldtk::tile_grid_base::tile_info oob_tile = level_bgs.out_of_bound_tile_info(layer.layer_identifier);
+        oob_tile.x_flip = !oob_tile.x_flip;
+        level_bgs.set_out_of_bound_tile_info(oob_tile, layer.layer_identifier);
+    }
+    bn::core::update();
+    check_last_frame_reloaded(ldtk::reload_reason::FORCE_RELOAD);
+}
+
+HOST_TEST(level_bgs_stats_keep_the_last_frames)
+{
+    ldtk::core::reset_stats();
+    HOST_CHECK(ldtk::core::stats().frames_count() == 0);
+
+    const ldtk::level& level = ldtk::gen::gen_project.levels()[0];
+    ldtk::level_bgs_ptr level_bgs = level.create_bgs(0, 0);
+
+    // Moves a column more every frame, so that each kept frame is distinguishable
+    for (int frame = 0; frame < ldtk::level_bgs_stats::max_frames * 2; ++frame)
+    {
+        bn::core::update();
+        HOST_CHECK(ldtk::core::stats().frames_count() == std::min(frame + 1, ldtk::level_bgs_stats::max_frames));
+        level_bgs.set_x(level_bgs.x() + 8 * (frame % 3 + 1));
+    }
+
+    for (int age = 1; age < ldtk::level_bgs_stats::max_frames; ++age)
+    {
+        const int frame = ldtk::level_bgs_stats::max_frames * 2 - 1 - age;
+        HOST_CHECK(ldtk::core::stats().frame(age).cells == 21 * ((frame - 1) % 3 + 1) * bgs_count());
+    }
+}
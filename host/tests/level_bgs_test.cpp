@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "host_test.h"
+
+#include "ldtk_gen_project.h"
+#include "ldtk_level_bgs_ptr.h"
+#include "ldtk_tileset_subset.h"
+
+#include <bn_camera_ptr.h>
+#include <bn_core.h>
+#include <bn_regular_bg_map_cell_info.h>
+#include <bn_regular_bg_ptr.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+constexpr int COLUMNS = 32;
+constexpr int ROWS = 32;
+
+struct random_generator
+{
+    std::uint32_t state;
+
+    auto next(int limit) -> int
+    {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<int>((state >> 16) % static_cast<std::uint32_t>(limit));
+    }
+
+    // Random offset in `[-limit, limit]` pixels, in quarter pixels.
+    auto next_offset(int limit) -> bn::fixed
+    {
+        return bn::fixed(next(limit * 8 + 1) - limit * 4) / 4;
+    }
+};
+
+auto floor_div(int a, int b) -> int
+{
+    return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+// Layers with a background, in the order `level_bgs_manager` creates them.
+auto bg_layers(const ldtk::level& level) -> std::vector<const ldtk::layer*>
+{
+    std::vector<const ldtk::layer*> result;
+
+    for (auto iter = level.layer_instances().rbegin(); iter != level.layer_instances().rend(); ++iter)
+    {
+        if (iter->auto_layer_tiles() || iter->grid_tiles())
+            result.push_back(&*iter);
+    }
+
+    return result;
+}
+
+// Map cell of the level's 8x8 cell, worked out straight from the tile grid & the tileset map.
+auto expected_cell(const ldtk::layer& layer, const ldtk::tile_grid_base::tile_info& oob_tile, int level_8x8_x,
+                   int level_8x8_y) -> bn::regular_bg_map_cell
+{
+    const ldtk::tile_grid_base& grid = layer.auto_layer_tiles() ? *layer.auto_layer_tiles() : *layer.grid_tiles();
+    const int m_tile_cnt = layer.grid_size() / 8;
+    const int grid_x = floor_div(level_8x8_x, m_tile_cnt);
+    const int grid_y = floor_div(level_8x8_y, m_tile_cnt);
+
+    const bool in_bound = grid_x >= 0 && grid_x < grid.c_width() && grid_y >= 0 && grid_y < grid.c_height();
+    const ldtk::tile_grid_base::tile_info tile_info = in_bound ? grid.cell_tile_info(grid_x, grid_y) : oob_tile;
+
+    const int round_x = level_8x8_x - grid_x * m_tile_cnt;
+    const int round_y = level_8x8_y - grid_y * m_tile_cnt;
+    const int tx = tile_info.x_flip ? m_tile_cnt - 1 - round_x : round_x;
+    const int ty = tile_info.y_flip ? m_tile_cnt - 1 - round_y : round_y;
+
+#if LDTK_GEN_LEVEL_TILESETS
+    const ldtk::tileset_subset* subset = layer.tileset_subset();
+#else
+    const ldtk::tileset_subset* subset = nullptr;
+#endif
+    const bn::regular_bg_item& tileset_bg_item = subset ? subset->bg_item() : layer.tileset_def()->bg_item();
+    const int tile_idx = subset ? subset->subset_tile_index(tile_info.index) : tile_info.index;
+
+    bn::regular_bg_map_cell_info cell_info(
+        tileset_bg_item.map_item().cells_ptr()[(tile_idx * m_tile_cnt * m_tile_cnt) + (ty * m_tile_cnt) + tx]);
+    if (tile_info.x_flip)
+        cell_info.set_horizontal_flip(!cell_info.horizontal_flip());
+    if (tile_info.y_flip)
+        cell_info.set_vertical_flip(!cell_info.vertical_flip());
+
+    return cell_info.cell();
+}
+
+// Counts the cells on the screen that differ from the expected ones.
+//
+// Only the position of each background is used to find out the cells on the screen,
+// so this doesn't share any of the streaming arithmetic of `level_bgs_manager`.
+auto count_wrong_cells(const ldtk::level_bgs_ptr& level_bgs, const ldtk::level& level) -> int
+{
+    const std::vector<const ldtk::layer*> layers = bg_layers(level);
+    const std::vector<const bn::host::regular_bg_state*>& bgs = bn::host::regular_bgs();
+    HOST_CHECK(bgs.size() == layers.size());
+
+    int wrong_cells = 0;
+
+    for (std::size_t bg_idx = 0; bg_idx < bgs.size() && bg_idx < layers.size(); ++bg_idx)
+    {
+        const bn::host::regular_bg_state& bg = *bgs[bg_idx];
+        const ldtk::layer& layer = *layers[bg_idx];
+        const ldtk::tile_grid_base::tile_info oob_tile = level_bgs.out_of_bound_tile_info(layer.identifier());
+
+        // Screen top-left pixel, in the level coordinate
+        const bn::fixed_point canvas_top_left = bg.position - bn::fixed_point(COLUMNS * 4, ROWS * 4);
+        const bn::fixed_point screen_top_left = -canvas_top_left - bn::fixed_point(120, 80);
+
+        const int first_x = floor_div(screen_top_left.x().floor_integer(), 8);
+        const int first_y = floor_div(screen_top_left.y().floor_integer(), 8);
+
+        for (int ly = first_y; ly <= first_y + 20; ++ly)
+        {
+            for (int lx = first_x; lx <= first_x + 30; ++lx)
+            {
+                const int cx = lx - floor_div(lx, COLUMNS) * COLUMNS;
+                const int cy = ly - floor_div(ly, ROWS) * ROWS;
+
+                if (bg.item.map_item().cell(cx, cy) != expected_cell(layer, oob_tile, lx, ly))
+                    ++wrong_cells;
+            }
+        }
+    }
+
+    return wrong_cells;
+}
+
+auto level_bgs_position(const ldtk::level& level, const bn::fixed_point& position, const bn::fixed_point& cam_position)
+    -> bn::fixed_point
+{
+    // Every layer of the sample project has no parallax
+    return position - cam_position - bn::fixed_point(level.px_width() / 2, level.px_height() / 2) +
+           bn::fixed_point(COLUMNS * 4, ROWS * 4);
+}
+
+} // namespace
+
+HOST_TEST(level_bgs_stream_the_cells_on_the_screen)
+{
+    random_generator random{0x1d7c};
+    bn::camera_ptr camera = bn::camera_ptr::create(0, 0);
+
+    for (const ldtk::level& level : ldtk::gen::gen_project.levels())
+    {
+        ldtk::level_bgs_ptr level_bgs = level.create_bgs(random.next_offset(64), random.next_offset(64));
+        level_bgs.set_camera(camera);
+        bn::core::update();
+        HOST_CHECK(count_wrong_cells(level_bgs, level) == 0);
+
+        for (int step = 0; step < 600; ++step)
+        {
+            switch (random.next(8))
+            {
+            case 0:
+                // Far enough to reload all the cells
+                level_bgs.set_position(level_bgs.position() + bn::fixed_point(random.next_offset(400), 0));
+                break;
+            case 1:
+                camera.set_position(camera.position() + bn::fixed_point(0, random.next_offset(300)));
+                break;
+            case 2:
+                camera.set_position(camera.position() +
+                                    bn::fixed_point(random.next_offset(12), random.next_offset(12)));
+                break;
+            default:
+                level_bgs.set_position(level_bgs.position() +
+                                       bn::fixed_point(random.next_offset(20), random.next_offset(20)));
+                break;
+            }
+
+            bn::core::update();
+            HOST_CHECK(count_wrong_cells(level_bgs, level) == 0);
+
+            for (const bn::host::regular_bg_state* bg : bn::host::regular_bgs())
+                HOST_CHECK(bg->position == level_bgs_position(level, level_bgs.position(), camera.position()));
+        }
+    }
+}
+
+HOST_TEST(level_bgs_reload_cells_only_when_moved)
+{
+    const ldtk::level& level = ldtk::gen::gen_project.levels()[0];
+    ldtk::level_bgs_ptr level_bgs = level.create_bgs(0, 0);
+    bn::core::update();
+
+    auto reloads = [] {
+        int result = 0;
+        for (const bn::host::regular_bg_state* bg : bn::host::regular_bgs())
+            result += bg->cells_reloads;
+        return result;
+    };
+
+    const int initial_reloads = reloads();
+    bn::core::update();
+    HOST_CHECK(reloads() == initial_reloads);
+
+    level_bgs.set_x(level_bgs.x() + 8);
+    bn::core::update();
+    HOST_CHECK(reloads() == initial_reloads + int(bn::host::regular_bgs().size()));
+    HOST_CHECK(count_wrong_cells(level_bgs, level) == 0);
+}
+
+HOST_TEST(level_bgs_refill_the_cells_after_hidden)
+{
+    const ldtk::level& level = ldtk::gen::gen_project.levels()[0];
+    ldtk::level_bgs_ptr level_bgs = level.create_bgs(0, 0);
+    bn::core::update();
+
+    level_bgs.set_visible(false);
+    bn::core::update();
+    for (const bn::host::regular_bg_state* bg : bn::host::regular_bgs())
+        HOST_CHECK(!bg->visible);
+
+    // Cells aren't streamed while hidden, so it has to fill them all when shown again
+    level_bgs.set_position(level_bgs.position() + bn::fixed_point(100, -60));
+    bn::core::update();
+    level_bgs.set_visible(true);
+    bn::core::update();
+    for (const bn::host::regular_bg_state* bg : bn::host::regular_bgs())
+        HOST_CHECK(bg->visible);
+    HOST_CHECK(count_wrong_cells(level_bgs, level) == 0);
+}
+
+HOST_TEST(level_bgs_release_the_bgs)
+{
+    {
+        ldtk::level_bgs_ptr level_bgs = ldtk::gen::gen_project.levels()[0].create_bgs(0, 0);
+        HOST_CHECK(!bn::host::regular_bgs().empty());
+    }
+
+    HOST_CHECK(bn::host::regular_bgs().empty());
+}
@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "host_test.h"
+
+#include "ldtk_gen_project.h"
+
+// The constexpr tests of `examples/tests` are compiled into this executable as well,
+// so these only cover what's left for the runtime: the look-ups on the generated data in the `.rodata`.
+
+HOST_TEST(levels_and_layers_look_up_themselves)
+{
+    const ldtk::project& project = ldtk::gen::gen_project;
+
+    for (const ldtk::level& level : project.levels())
+    {
+        HOST_CHECK(&project.get_level(level.identifier()) == &level);
+
+        for (const ldtk::layer& layer : level.layer_instances())
+        {
+            HOST_CHECK(&level.get_layer(layer.identifier()) == &layer);
+
+            for (const ldtk::entity& entity : layer.entity_instances())
+                HOST_CHECK(&layer.find_entity(entity.iid()) == &entity);
+        }
+    }
+}
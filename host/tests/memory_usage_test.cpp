@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "host_test.h"
+
+#include "ldtk_core.h"
+#include "ldtk_gen_project.h"
+#include "ldtk_level_bgs_ptr.h"
+
+#include <bn_config_bgs.h>
+#include <bn_optional.h>
+#include <bn_regular_bg_map_cell.h>
+
+HOST_TEST(memory_usage_counts_the_pools_in_use)
+{
+    const ldtk::memory_usage before = ldtk::core::memory_usage();
+    HOST_CHECK(before.bgs_count == 0);
+    HOST_CHECK(before.levels_count == 0);
+    HOST_CHECK(before.used_bytes() == 0);
+    HOST_CHECK(before.max_bgs_count == BN_CFG_BGS_MAX_ITEMS);
+    HOST_CHECK(before.max_levels_count == BN_CFG_BGS_MAX_ITEMS);
+    HOST_CHECK(before.cells_bytes == int(32 * 32 * sizeof(bn::regular_bg_map_cell)));
+    HOST_CHECK(before.bg_bytes > before.cells_bytes);
+    HOST_CHECK(before.total_bytes >= before.max_bgs_count * before.bg_bytes +
+                                         before.max_levels_count * before.level_bytes);
+
+    const ldtk::level& level = ldtk::gen::gen_project.levels()[0];
+    int layer_bgs_count = 0;
+    for (const ldtk::layer& layer : level.layer_instances())
+        layer_bgs_count += (layer.auto_layer_tiles() || layer.grid_tiles());
+
+    {
+        ldtk::level_bgs_ptr level_bgs = level.create_bgs(0, 0);
+        bn::optional<ldtk::level_bgs_ptr> copy = level_bgs;
+
+        const ldtk::memory_usage usage = ldtk::core::memory_usage();
+        HOST_CHECK(usage.bgs_count == layer_bgs_count);
+        HOST_CHECK(usage.levels_count == 1);
+        HOST_CHECK(usage.used_bytes() == layer_bgs_count * usage.bg_bytes + usage.level_bytes);
+        HOST_CHECK(usage.total_bytes == before.total_bytes);
+    }
+
+    HOST_CHECK(ldtk::core::memory_usage().used_bytes() == 0);
+}
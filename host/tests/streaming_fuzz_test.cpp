@@ -0,0 +1,287 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#include "host_test.h"
+
+#include "ldtk_core.h"
+#include "ldtk_gen_project.h"
+#include "ldtk_level_bgs_ptr.h"
+
+#include <bn_camera_ptr.h>
+#include <bn_core.h>
+#include <bn_math.h>
+#include <bn_regular_bg_ptr.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Differential fuzzer of the incremental cells streaming.
+//
+// Every frame streams the cells of random camera walks, level moves, out-of-bound tile changes & visibility toggles,
+// then forces every visible layer to reload all of its cells (`reset_all_cells()`) at the same position,
+// and the cells on the screen must be the same before & after the reload.
+//
+// `LDTK_FUZZ_FRAMES` & `LDTK_FUZZ_SEED` environment variables change the frames per level & the random seed.
+
+// Built with `LDTK_CFG_STATS_ENABLED` to count the cells written per frame.
+static_assert(LDTK_CFG_STATS_ENABLED);
+
+namespace
+{
+
+constexpr int COLUMNS = 32;
+constexpr int ROWS = 32;
+constexpr int SCREEN_COLUMNS = 31;
+constexpr int SCREEN_ROWS = 21;
+
+constexpr int DEFAULT_FRAMES = 200;
+constexpr int DEFAULT_SEED = 1;
+
+// Camera speed limit, in pixels per frame
+constexpr int MAX_SPEED = 24;
+
+struct random_generator
+{
+    std::uint32_t state;
+
+    auto next(int limit) -> int
+    {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<int>((state >> 16) % static_cast<std::uint32_t>(limit));
+    }
+
+    auto chance(int one_in) -> bool
+    {
+        return next(one_in) == 0;
+    }
+
+    // Random offset in `[-limit, limit]` pixels, in quarter pixels.
+    auto next_offset(int limit) -> bn::fixed
+    {
+        return bn::fixed(next(limit * 8 + 1) - limit * 4) / 4;
+    }
+};
+
+struct fuzz_stats
+{
+    int frames = 0;
+    std::int64_t cells = 0;
+    int max_cells = 0;
+    int reloads[ldtk::reload_reasons_count] = {};
+    int over_full_reload = 0; // Incremental updates of a layer writing more cells than a full reload
+    int mismatched_frames = 0;
+};
+
+auto env_int(const char* name, int default_value) -> int
+{
+    const char* value = std::getenv(name);
+    return value ? std::atoi(value) : default_value;
+}
+
+auto floor_div(int a, int b) -> int
+{
+    return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+// Cells on the screen of every background in the creation order, empty if the background is hidden.
+//
+// Only the position of each background is used to find out the cells on the screen.
+auto screen_cells() -> std::vector<std::vector<bn::regular_bg_map_cell>>
+{
+    std::vector<std::vector<bn::regular_bg_map_cell>> result;
+
+    for (const bn::host::regular_bg_state* bg : bn::host::regular_bgs())
+    {
+        std::vector<bn::regular_bg_map_cell>& cells = result.emplace_back();
+
+        // Cells aren't streamed while hidden
+        if (!bg->visible)
+            continue;
+
+        // Screen top-left pixel, in the level coordinate
+        const bn::fixed_point canvas_top_left = bg->position - bn::fixed_point(COLUMNS * 4, ROWS * 4);
+        const bn::fixed_point screen_top_left = -canvas_top_left - bn::fixed_point(120, 80);
+
+        const int first_x = floor_div(screen_top_left.x().floor_integer(), 8);
+        const int first_y = floor_div(screen_top_left.y().floor_integer(), 8);
+
+        for (int ly = first_y; ly < first_y + SCREEN_ROWS; ++ly)
+        {
+            for (int lx = first_x; lx < first_x + SCREEN_COLUMNS; ++lx)
+            {
+                const int cx = lx - floor_div(lx, COLUMNS) * COLUMNS;
+                const int cy = ly - floor_div(ly, ROWS) * ROWS;
+                cells.push_back(bg->item.map_item().cell(cx, cy));
+            }
+        }
+    }
+
+    return result;
+}
+
+auto bg_layer_identifiers(const ldtk::level_bgs_ptr& level_bgs, const ldtk::level& level)
+    -> std::vector<ldtk::gen::layer_ident>
+{
+    std::vector<ldtk::gen::layer_ident> result;
+
+    for (const ldtk::layer& layer : level.layer_instances())
+    {
+        if (level_bgs.has_background(layer.identifier()))
+            result.push_back(layer.identifier());
+    }
+
+    return result;
+}
+
+auto random_tile_info(random_generator& random, const ldtk::level& level, ldtk::gen::layer_ident layer_identifier)
+    -> ldtk::tile_grid_base::tile_info
+{
+    const ldtk::layer& layer = level.get_layer(layer_identifier);
+    const ldtk::tile_grid_base& grid = layer.auto_layer_tiles() ? *layer.auto_layer_tiles() : *layer.grid_tiles();
+
+    ldtk::tile_grid_base::tile_info result =
+        grid.cell_tile_info(random.next(grid.c_width()), random.next(grid.c_height()));
+    result.x_flip = random.chance(2);
+    result.y_flip = random.chance(2);
+    return result;
+}
+
+// Randomizes the camera, the level & its backgrounds for the next frame.
+void step(random_generator& random, const ldtk::level& level, ldtk::level_bgs_ptr& level_bgs, bn::camera_ptr& camera,
+          bn::fixed_point& velocity)
+{
+    const std::vector<ldtk::gen::layer_ident> layers = bg_layer_identifiers(level_bgs, level);
+
+    // Walks around the level, turning back once it's off the level by a screen
+    velocity += bn::fixed_point(random.next_offset(2), random.next_offset(2));
+    const bn::fixed_point from_center = camera.position() - level_bgs.position();
+    if (bn::abs(from_center.x()) > level.px_width() / 2 + 240)
+        velocity.set_x(from_center.x() > 0 ? -bn::abs(velocity.x()) : bn::abs(velocity.x()));
+    if (bn::abs(from_center.y()) > level.px_height() / 2 + 160)
+        velocity.set_y(from_center.y() > 0 ? -bn::abs(velocity.y()) : bn::abs(velocity.y()));
+    velocity.set_x(std::clamp(velocity.x(), bn::fixed(-MAX_SPEED), bn::fixed(MAX_SPEED)));
+    velocity.set_y(std::clamp(velocity.y(), bn::fixed(-MAX_SPEED), bn::fixed(MAX_SPEED)));
+    camera.set_position(camera.position() + velocity);
+
+    // Dashes up to a bit more than a screen, around where it stops streaming & reloads all the cells
+    if (random.chance(32))
+        camera.set_position(camera.position() + bn::fixed_point(random.next_offset(280), random.next_offset(190)));
+    if (random.chance(64))
+        camera.set_position(level_bgs.position() + bn::fixed_point(random.next_offset(level.px_width() / 2 + 240),
+                                                                   random.next_offset(level.px_height() / 2 + 160)));
+    if (random.chance(16))
+        level_bgs.set_position(level_bgs.position() +
+                               bn::fixed_point(random.next_offset(40), random.next_offset(40)));
+    if (random.chance(64) && !layers.empty())
+    {
+        const ldtk::gen::layer_ident layer = layers[random.next(int(layers.size()))];
+        level_bgs.set_visible(!level_bgs.visible(layer), layer);
+    }
+    if (random.chance(256))
+        level_bgs.set_visible(random.chance(2));
+    if (random.chance(64) && !layers.empty())
+    {
+        const ldtk::gen::layer_ident layer = layers[random.next(int(layers.size()))];
+        level_bgs.set_out_of_bound_tile_info(random_tile_info(random, level, layer), layer);
+    }
+    if (random.chance(256))
+    {
+        if (level_bgs.camera())
+            level_bgs.remove_camera();
+        else
+            level_bgs.set_camera(camera);
+    }
+}
+
+// Forces every visible layer to reload all of its cells, without moving.
+void force_reload(const ldtk::level& level, ldtk::level_bgs_ptr& level_bgs)
+{
+    for (const ldtk::gen::layer_ident layer : bg_layer_identifiers(level_bgs, level))
+    {
+        if (level_bgs.visible(layer))
+            level_bgs.set_out_of_bound_tile_info(level_bgs.out_of_bound_tile_info(layer), layer);
+    }
+
+    bn::core::update();
+}
+
+void count_frame(fuzz_stats& stats)
+{
+    const ldtk::frame_stats& frame = ldtk::core::stats().frame(0);
+
+    ++stats.frames;
+    stats.cells += frame.cells;
+    stats.max_cells = std::max(stats.max_cells, frame.cells);
+
+    for (const ldtk::layer_frame_stats& layer : frame.layers)
+    {
+        if (layer.reload)
+            ++stats.reloads[int(*layer.reload)];
+        else if (layer.cells > SCREEN_COLUMNS * SCREEN_ROWS)
+            ++stats.over_full_reload;
+    }
+}
+
+void print_stats(const fuzz_stats& stats, int seed)
+{
+    static constexpr const char* reason_names[ldtk::reload_reasons_count] = {"SET_LEVEL", "FORCE_RELOAD", "BIG_JUMP",
+                                                                             "VISIBILITY"};
+
+    std::cout << "seed " << seed << ", " << stats.frames << " frames: "
+              << (stats.frames ? stats.cells / stats.frames : 0) << " cells/frame on average, " << stats.max_cells
+              << " at most, " << stats.over_full_reload << " layer updates over a full reload (" << SCREEN_COLUMNS
+              << 'x' << SCREEN_ROWS << " cells)\n";
+    std::cout << "reloads:";
+    for (int reason = 0; reason < ldtk::reload_reasons_count; ++reason)
+        std::cout << ' ' << reason_names[reason] << ' ' << stats.reloads[reason];
+    std::cout << '\n';
+}
+
+} // namespace
+
+HOST_TEST(level_bgs_streaming_matches_full_reloads)
+{
+    const int frames = env_int("LDTK_FUZZ_FRAMES", DEFAULT_FRAMES);
+    const int seed = env_int("LDTK_FUZZ_SEED", DEFAULT_SEED);
+
+    random_generator random{std::uint32_t(seed)};
+    fuzz_stats stats;
+    const auto levels = ldtk::gen::gen_project.levels();
+
+    for (int level_idx = 0; level_idx < int(levels.size()); ++level_idx)
+    {
+        const ldtk::level& level = levels[level_idx];
+        bn::camera_ptr camera = bn::camera_ptr::create(0, 0);
+        bn::fixed_point velocity;
+
+        ldtk::level_bgs_ptr level_bgs = level.create_bgs(random.next_offset(64), random.next_offset(64));
+        level_bgs.set_camera(camera);
+        bn::core::update();
+
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            step(random, level, level_bgs, camera, velocity);
+            bn::core::update();
+            count_frame(stats);
+
+            const std::vector<std::vector<bn::regular_bg_map_cell>> streamed = screen_cells();
+            force_reload(level, level_bgs);
+
+            if (screen_cells() != streamed)
+            {
+                ++stats.mismatched_frames;
+                HOST_CHECK(!"streamed cells differ from a full reload");
+                std::cerr << "seed " << seed << ", level " << level_idx << ", frame " << frame << ": camera ("
+                          << camera.x() << ", " << camera.y() << "), level_bgs (" << level_bgs.x() << ", "
+                          << level_bgs.y() << ")\n";
+                break;
+            }
+        }
+    }
+
+    print_stats(stats, seed);
+    HOST_CHECK(stats.mismatched_frames == 0);
+}
@@ -3,10 +3,26 @@
 
 #pragma once
 
+#include "ldtk_level_bgs_stats.h"
+#include "ldtk_memory_usage.h"
+
 namespace ldtk::core
 {
 
 /// @brief This function **must** be called before using butano-ldtk, and it must be called **only once**.
 void init();
 
+/// @brief Get the EWRAM used by the level backgrounds, including the pools in use.
+[[nodiscard]] auto memory_usage() -> ldtk::memory_usage;
+
+#if LDTK_CFG_STATS_ENABLED
+/// @brief Get the counters of the level backgrounds, which are updated by `bn::core::update()`.
+/// @note Only available when `LDTK_CFG_STATS_ENABLED` is `true`.
+[[nodiscard]] auto stats() -> const level_bgs_stats&;
+
+/// @brief Resets the counters of the level backgrounds, including the kept frames.
+/// @note Only available when `LDTK_CFG_STATS_ENABLED` is `true`.
+void reset_stats();
+#endif
+
 } // namespace ldtk::core
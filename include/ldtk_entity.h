@@ -6,6 +6,7 @@
 #include "ldtk_entity_definition.h"
 
 #include "ldtk_field.h"
+#include "ldtk_gen_config.h"
 #include "ldtk_gen_idents_fwd.h"
 #include "ldtk_gen_iids_fwd.h"
 #include "ldtk_gen_tags_fwd.h"
@@ -16,6 +17,20 @@
 #include <bn_size.h>
 #include <bn_span.h>
 
+#include <cstdint>
+
+#if LDTK_GEN_COMPACT
+/// @cond DO_NOT_DOCUMENT
+namespace ldtk::gen::priv
+{
+
+/// @brief Project-wide pool of the entity field instances, defined in `ldtk_gen_priv_layer_entity_field_instances.h`
+constexpr auto gen_priv_entity_field_pool() -> const field*;
+
+} // namespace ldtk::gen::priv
+/// @endcond
+#endif
+
 namespace ldtk
 {
 
@@ -23,11 +38,20 @@ class entity
 {
 public:
     /// @cond DO_NOT_DOCUMENT
+#if LDTK_GEN_COMPACT
+    constexpr entity(const entity_definition& def, const bn::point& grid, int field_instances_offset,
+                     const bn::size& size, gen::entity_iid iid, const bn::point& px)
+        : _def(def), _grid_x(grid.x()), _grid_y(grid.y()), _px_x(px.x()), _px_y(px.y()), _width(size.width()),
+          _height(size.height()), _field_instances_offset(field_instances_offset), _iid(iid)
+    {
+    }
+#else
     constexpr entity(const entity_definition& def, const bn::point& grid, const bn::span<const field>& field_instances,
                      const bn::size& size, gen::entity_iid iid, const bn::point& px)
         : _def(def), _grid(grid), _field_instances(field_instances), _size(size), _iid(iid), _px(px)
     {
     }
+#endif
     /// @endcond
 
     /// @brief Deleted copy constructor.
@@ -52,10 +76,10 @@ public:
     [[nodiscard]] constexpr auto get_field(gen::entity_field_ident identifier) const -> const field&
     {
         BN_ASSERT((int)identifier >= 0, "Invalid identifier (gen::entity_field_ident)", (int)identifier);
-        BN_ASSERT((int)identifier < _field_instances.size(), "Out of bound identifier (gen::entity_field_ident)",
+        BN_ASSERT((int)identifier < field_instances().size(), "Out of bound identifier (gen::entity_field_ident)",
                   (int)identifier, " - perhaps it's a field of different entity kind");
 
-        return _field_instances.data()[(int)identifier];
+        return field_instances().data()[(int)identifier];
     }
 
 public:
@@ -66,10 +90,17 @@ public:
     }
 
     /// @brief Grid-based coordinates (`[x,y]` format)
+#if LDTK_GEN_COMPACT
+    [[nodiscard]] constexpr auto grid() const -> bn::point
+    {
+        return bn::point(_grid_x, _grid_y);
+    }
+#else
     [[nodiscard]] constexpr auto grid() const -> const bn::point&
     {
         return _grid;
     }
+#endif
 
     /// @brief Entity definition identifier
     [[nodiscard]] constexpr auto identifier() const -> gen::entity_ident
@@ -89,18 +120,51 @@ public:
         return def().tags();
     }
 
+    /// @brief Checks if this entity has the tag, in O(1).
+    [[nodiscard]] constexpr auto has_tag(gen::entity_tag tag) const -> bool
+    {
+        return def().has_tag(tag);
+    }
+
+    /// @brief Checks if this entity has any of the tags in the mask, in O(1).
+    [[nodiscard]] constexpr auto has_any_tags(entity_tag_mask mask) const -> bool
+    {
+        return def().has_any_tags(mask);
+    }
+
+    /// @brief Checks if this entity has all of the tags in the mask, in O(1).
+    [[nodiscard]] constexpr auto has_all_tags(entity_tag_mask mask) const -> bool
+    {
+        return def().has_all_tags(mask);
+    }
+
     /// @brief An array of all custom fields and their values.
+#if LDTK_GEN_COMPACT
+    [[nodiscard]] constexpr auto field_instances() const -> bn::span<const field>
+    {
+        return bn::span<const field>(gen::priv::gen_priv_entity_field_pool() + _field_instances_offset,
+                                     def().field_defs().size());
+    }
+#else
     [[nodiscard]] constexpr auto field_instances() const -> const bn::span<const field>&
     {
         return _field_instances;
     }
+#endif
 
     /// @brief Entity size in pixels.
     /// For non-resizable entities, it will be the same as Entity definition.
+#if LDTK_GEN_COMPACT
+    [[nodiscard]] constexpr auto size() const -> bn::size
+    {
+        return bn::size(_width, _height);
+    }
+#else
     [[nodiscard]] constexpr auto size() const -> const bn::size&
     {
         return _size;
     }
+#endif
 
     /// @brief Entity width in pixels.
     /// For non-resizable entities, it will be the same as Entity definition.
@@ -124,12 +188,32 @@ public:
 
     /// @brief Pixel coordinates (`[x,y]` format) in current level coordinate space.
     /// Don't forget optional layer offsets, if they exist!
+#if LDTK_GEN_COMPACT
+    [[nodiscard]] constexpr auto px() const -> bn::point
+    {
+        return bn::point(_px_x, _px_y);
+    }
+#else
     [[nodiscard]] constexpr auto px() const -> const bn::point&
     {
         return _px;
     }
+#endif
 
 private:
+#if LDTK_GEN_COMPACT
+    const entity_definition& _def;
+
+    std::int16_t _grid_x;
+    std::int16_t _grid_y;
+    std::int16_t _px_x;
+    std::int16_t _px_y;
+    std::uint16_t _width;
+    std::uint16_t _height;
+
+    std::uint16_t _field_instances_offset;
+    gen::entity_iid _iid;
+#else
     const entity_definition& _def;
 
     bn::point _grid;
@@ -138,6 +222,11 @@ private:
     bn::size _size;
     gen::entity_iid _iid;
     bn::point _px;
+#endif
 };
 
 } // namespace ldtk
+
+#if LDTK_GEN_COMPACT
+#include "ldtk_gen_priv_layer_entity_field_instances.h"
+#endif
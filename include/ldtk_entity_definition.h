@@ -6,6 +6,7 @@
 #include "ldtk_field_definition.h"
 #include "ldtk_gen_idents_fwd.h"
 #include "ldtk_gen_tags_fwd.h"
+#include "ldtk_tag_mask.h"
 
 #include <bn_fixed_point.h>
 #include <bn_size.h>
@@ -31,10 +32,10 @@ public:
     /// @cond DO_NOT_DOCUMENT
     constexpr entity_definition(const bn::size& size, gen::entity_ident identifier, bn::fixed_point pivot, int uid,
                                 const bn::span<const field_definition>& field_defs,
-                                const bn::span<const gen::entity_tag>& tags, std::uint16_t max_count,
-                                limit_scope_kind limit_scope)
+                                const bn::span<const gen::entity_tag>& tags, entity_tag_mask tag_mask,
+                                std::uint16_t max_count, limit_scope_kind limit_scope)
         : _size(size), _identifier(identifier), _pivot(pivot), _uid(uid), _field_defs(field_defs), _tags(tags),
-          _max_count(max_count), _limit_scope(limit_scope)
+          _tag_mask(tag_mask), _max_count(max_count), _limit_scope(limit_scope)
     {
     }
     /// @endcond
@@ -100,6 +101,30 @@ public:
         return _tags;
     }
 
+    /// @brief Bitmask of the `tags()`
+    [[nodiscard]] constexpr auto tag_mask() const -> entity_tag_mask
+    {
+        return _tag_mask;
+    }
+
+    /// @brief Checks if this entity has the tag, in O(1).
+    [[nodiscard]] constexpr auto has_tag(gen::entity_tag tag) const -> bool
+    {
+        return has_any_tags(ldtk::tag_mask(tag));
+    }
+
+    /// @brief Checks if this entity has any of the tags in the mask, in O(1).
+    [[nodiscard]] constexpr auto has_any_tags(entity_tag_mask mask) const -> bool
+    {
+        return (_tag_mask & mask) != 0;
+    }
+
+    /// @brief Checks if this entity has all of the tags in the mask, in O(1).
+    [[nodiscard]] constexpr auto has_all_tags(entity_tag_mask mask) const -> bool
+    {
+        return (_tag_mask & mask) == mask;
+    }
+
     /// @brief Max entities count. The scope is indicated via `limit_scope()`
     /// @note `0` means it's unlimited.
     [[nodiscard]] constexpr auto max_count() const -> int
@@ -120,6 +145,7 @@ private:
     int _uid;
     bn::span<const field_definition> _field_defs;
     bn::span<const gen::entity_tag> _tags;
+    entity_tag_mask _tag_mask;
     std::uint16_t _max_count;
     limit_scope_kind _limit_scope;
 };
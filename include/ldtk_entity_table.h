@@ -0,0 +1,235 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "ldtk_entity.h"
+#include "ldtk_field.h"
+#include "ldtk_gen_config.h"
+#include "ldtk_gen_idents_fwd.h"
+
+#include <bn_assert.h>
+#include <bn_point.h>
+#include <bn_size.h>
+#include <bn_span.h>
+
+#include <cstdint>
+
+namespace ldtk
+{
+
+/// @brief Structure-of-arrays view of the entity instances of a layer instance.
+/// @details Each column (position, identifier, size...) is stored in its own array,
+/// so that a loop reading only a few of them doesn't load the whole `entity` of each element. \n
+/// Only generated when `--entity-tables` is passed to `butano_ldtk.py`.
+class entity_table
+{
+public:
+    /// @brief Lightweight proxy of a single row of the `entity_table`.
+    class row
+    {
+    public:
+        /// @cond DO_NOT_DOCUMENT
+        constexpr row(const entity_table& table, int index) : _table(table), _index(index)
+        {
+        }
+        /// @endcond
+
+    public:
+        /// @brief Looks up a field with its identifier.
+        /// @note Look-up is done via indexing, thus it's O(1). \n
+        /// @b Never use unrelated entity's field identifier,
+        /// that would result in an error, or getting the wrong field.
+        /// @param identifier Unique identifier of the field to look up.
+        /// @return Reference to the field.
+        [[nodiscard]] constexpr auto get_field(gen::entity_field_ident identifier) const -> const field&
+        {
+            return instance().get_field(identifier);
+        }
+
+    public:
+        /// @brief Index of this row in the table.
+        [[nodiscard]] constexpr auto index() const -> int
+        {
+            return _index;
+        }
+
+        /// @brief Entity definition identifier
+        [[nodiscard]] constexpr auto identifier() const -> gen::entity_ident
+        {
+            return _table._identifiers[_index];
+        }
+
+        /// @brief Pixel coordinates (`[x,y]` format) in current level coordinate space.
+        [[nodiscard]] constexpr auto px() const -> bn::point
+        {
+            return bn::point(px_x(), px_y());
+        }
+
+        /// @brief Pixel X coordinate in current level coordinate space.
+        [[nodiscard]] constexpr auto px_x() const -> int
+        {
+            return _table._px_x[_index];
+        }
+
+        /// @brief Pixel Y coordinate in current level coordinate space.
+        [[nodiscard]] constexpr auto px_y() const -> int
+        {
+            return _table._px_y[_index];
+        }
+
+        /// @brief Entity size in pixels.
+        [[nodiscard]] constexpr auto size() const -> bn::size
+        {
+            return bn::size(width(), height());
+        }
+
+        /// @brief Entity width in pixels.
+        [[nodiscard]] constexpr auto width() const -> int
+        {
+            return _table._widths[_index];
+        }
+
+        /// @brief Entity height in pixels.
+        [[nodiscard]] constexpr auto height() const -> int
+        {
+            return _table._heights[_index];
+        }
+
+        /// @brief An array of all custom fields and their values.
+        [[nodiscard]] constexpr auto field_instances() const -> bn::span<const field>
+        {
+#if LDTK_GEN_COMPACT
+            const field* field_pool = gen::priv::gen_priv_entity_field_pool();
+#else
+            const field* field_pool = _table._field_pool;
+#endif
+            return bn::span<const field>(field_pool + _table._field_offsets[_index],
+                                         instance().def().field_defs().size());
+        }
+
+        /// @brief Reference to the full entity instance of this row.
+        [[nodiscard]] constexpr auto instance() const -> const entity&
+        {
+            return _table._entities[_index];
+        }
+
+    private:
+        const entity_table& _table;
+        int _index;
+    };
+
+public:
+    /// @cond DO_NOT_DOCUMENT
+#if LDTK_GEN_COMPACT
+    constexpr entity_table(int size, const std::int16_t* px_x, const std::int16_t* px_y,
+                           const gen::entity_ident* identifiers, const std::uint16_t* widths,
+                           const std::uint16_t* heights, const std::uint16_t* field_offsets, const entity* entities)
+        : _px_x(px_x), _px_y(px_y), _identifiers(identifiers), _widths(widths), _heights(heights),
+          _field_offsets(field_offsets), _entities(entities), _size(size)
+    {
+    }
+#else
+    constexpr entity_table(int size, const std::int16_t* px_x, const std::int16_t* px_y,
+                           const gen::entity_ident* identifiers, const std::uint16_t* widths,
+                           const std::uint16_t* heights, const std::uint16_t* field_offsets, const field* field_pool,
+                           const entity* entities)
+        : _px_x(px_x), _px_y(px_y), _identifiers(identifiers), _widths(widths), _heights(heights),
+          _field_offsets(field_offsets), _field_pool(field_pool), _entities(entities), _size(size)
+    {
+    }
+#endif
+    /// @endcond
+
+    /// @brief Deleted copy constructor.
+    constexpr entity_table(const entity_table&) = delete;
+
+    /// @brief Deleted copy assignment operator.
+    constexpr entity_table& operator=(const entity_table&) = delete;
+
+    /// @brief Defaulted move constructor.
+    constexpr entity_table(entity_table&&) = default;
+
+    /// @brief Defaulted move assignment operator.
+    constexpr entity_table& operator=(entity_table&&) = default;
+
+public:
+    /// @brief Returns the proxy of the row at the given index.
+    [[nodiscard]] constexpr auto operator[](int index) const -> row
+    {
+        BN_ASSERT(index >= 0 && index < _size, "Invalid index: ", index, " (size: ", _size, ")");
+
+        return row(*this, index);
+    }
+
+    /// @brief Number of rows (entity instances) in the table.
+    [[nodiscard]] constexpr auto size() const -> int
+    {
+        return _size;
+    }
+
+    /// @brief Indicates if the table has no rows.
+    [[nodiscard]] constexpr auto empty() const -> bool
+    {
+        return _size == 0;
+    }
+
+public:
+    /// @brief Pixel X coordinates column
+    [[nodiscard]] constexpr auto px_x() const -> bn::span<const std::int16_t>
+    {
+        return bn::span<const std::int16_t>(_px_x, _size);
+    }
+
+    /// @brief Pixel Y coordinates column
+    [[nodiscard]] constexpr auto px_y() const -> bn::span<const std::int16_t>
+    {
+        return bn::span<const std::int16_t>(_px_y, _size);
+    }
+
+    /// @brief Entity definition identifiers column
+    [[nodiscard]] constexpr auto identifiers() const -> bn::span<const gen::entity_ident>
+    {
+        return bn::span<const gen::entity_ident>(_identifiers, _size);
+    }
+
+    /// @brief Entity widths column
+    [[nodiscard]] constexpr auto widths() const -> bn::span<const std::uint16_t>
+    {
+        return bn::span<const std::uint16_t>(_widths, _size);
+    }
+
+    /// @brief Entity heights column
+    [[nodiscard]] constexpr auto heights() const -> bn::span<const std::uint16_t>
+    {
+        return bn::span<const std::uint16_t>(_heights, _size);
+    }
+
+    /// @brief Offsets of the field instances in the entity field pool column. \n
+    /// The pool is project-wide with `--compact`, otherwise it's of the level.
+    [[nodiscard]] constexpr auto field_offsets() const -> bn::span<const std::uint16_t>
+    {
+        return bn::span<const std::uint16_t>(_field_offsets, _size);
+    }
+
+    /// @brief Full entity instances, in the same order as the rows.
+    [[nodiscard]] constexpr auto instances() const -> bn::span<const entity>
+    {
+        return bn::span<const entity>(_entities, _size);
+    }
+
+private:
+    const std::int16_t* _px_x;
+    const std::int16_t* _px_y;
+    const gen::entity_ident* _identifiers;
+    const std::uint16_t* _widths;
+    const std::uint16_t* _heights;
+    const std::uint16_t* _field_offsets;
+#if !LDTK_GEN_COMPACT
+    const field* _field_pool;
+#endif
+    const entity* _entities;
+    int _size;
+};
+
+} // namespace ldtk
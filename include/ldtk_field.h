@@ -7,8 +7,10 @@
 
 #include "ldtk_entity_ref.h"
 #include "ldtk_field_type.h"
+#include "ldtk_gen_config.h"
 #include "ldtk_gen_idents_fwd.h"
 #include "ldtk_priv_concepts.h"
+#include "ldtk_priv_int64_words.h"
 #include "ldtk_priv_optional_typed_enum_span.h"
 #include "ldtk_priv_typed_enum.h"
 #include "ldtk_priv_typed_enum_span.h"
@@ -1095,7 +1097,7 @@ public:
         }
         else
         {
-            static_assert(false, "Invalid type parameter T provided");
+            static_assert(sizeof(T) == 0, "Invalid type parameter T provided");
         }
     }
 
@@ -1116,13 +1118,22 @@ private:
         std::int16_t s16;
         std::uint32_t u32;
         std::int32_t s32;
+#if LDTK_GEN_COMPACT
+        priv::int64_words<std::uint64_t> u64;
+        priv::int64_words<std::int64_t> s64;
+#else
         std::uint64_t u64;
         std::int64_t s64;
+#endif
         bn::fixed fixed;
         bool flag;
         bn::string_view str;
         bn::color color;
+#if LDTK_GEN_COMPACT
+        priv::untyped_enum t_enum;
+#else
         priv::typed_enum t_enum;
+#endif
         // tile tile;
         entity_ref ent_ref;
         bn::point point;
@@ -1139,7 +1150,11 @@ private:
         bn::span<const bool> flag_span;
         bn::span<const bn::string_view> str_span;
         bn::span<const bn::color> color_span;
+#if LDTK_GEN_COMPACT
+        priv::untyped_enum_span t_enum_span;
+#else
         priv::typed_enum_span t_enum_span;
+#endif
         // bn::span<const tile> tile_span;
         bn::span<const entity_ref> ent_ref_span;
         bn::span<const bn::point> point_span;
@@ -1154,7 +1169,11 @@ private:
         bn::span<const bn::optional<std::int64_t>> opt_s64_span;
         bn::span<const bn::optional<bn::fixed>> opt_fixed_span;
         bn::span<const bn::optional<bn::string_view>> opt_str_span;
+#if LDTK_GEN_COMPACT
+        priv::optional_untyped_enum_span opt_t_enum_span;
+#else
         priv::optional_typed_enum_span opt_t_enum_span;
+#endif
         // bn::span<const bn::optional<tile>> opt_tile_span;
         bn::span<const bn::optional<entity_ref>> opt_ent_ref_span;
         bn::span<const bn::optional<bn::point>> opt_point_span;
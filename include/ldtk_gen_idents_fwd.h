@@ -3,16 +3,18 @@
 
 #pragma once
 
+#include "ldtk_gen_config.h"
+
 namespace ldtk::gen
 {
 
-enum class tileset_ident;
-enum class level_ident;
-enum class level_field_ident;
-enum class layer_ident;
-enum class layer_int_grid_value_ident;
-enum class layer_int_grid_value_group_ident;
-enum class entity_ident;
-enum class entity_field_ident;
+enum class tileset_ident : priv::tileset_ident_underlying_type;
+enum class level_ident : priv::level_ident_underlying_type;
+enum class level_field_ident : priv::level_field_ident_underlying_type;
+enum class layer_ident : priv::layer_ident_underlying_type;
+enum class layer_int_grid_value_ident : priv::layer_int_grid_value_ident_underlying_type;
+enum class layer_int_grid_value_group_ident : priv::layer_int_grid_value_group_ident_underlying_type;
+enum class entity_ident : priv::entity_ident_underlying_type;
+enum class entity_field_ident : priv::entity_field_ident_underlying_type;
 
 } // namespace ldtk::gen
@@ -3,12 +3,14 @@
 
 #pragma once
 
+#include "ldtk_gen_config.h"
+
 namespace ldtk::gen
 {
 
-enum class project_iid;
-enum class level_iid;
-enum class layer_iid;
-enum class entity_iid;
+enum class project_iid : priv::project_iid_underlying_type;
+enum class level_iid : priv::level_iid_underlying_type;
+enum class layer_iid : priv::layer_iid_underlying_type;
+enum class entity_iid : priv::entity_iid_underlying_type;
 
 } // namespace ldtk::gen
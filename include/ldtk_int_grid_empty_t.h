@@ -17,6 +17,11 @@ public:
     constexpr int_grid_empty_t(int c_width, int c_height) : int_grid_base(c_width, c_height)
     {
     }
+
+    // User-provided, as GCC 12 can't use the implicit constexpr virtual destructor in a constant expression.
+    constexpr ~int_grid_empty_t() override
+    {
+    }
     /// @endcond
 
     /// @brief Get the size of bytes used for cell storage. \n
@@ -7,11 +7,15 @@
 #include "ldtk_tileset_definition.h"
 
 #include "ldtk_entity.h"
+#include "ldtk_entity_table.h"
+#include "ldtk_gen_config.h"
 #include "ldtk_gen_idents_fwd.h"
 #include "ldtk_gen_iids_fwd.h"
+#include "ldtk_gen_tags_fwd.h"
 #include "ldtk_int_grid_base.h"
 #include "ldtk_layer_type.h"
 #include "ldtk_tile_grid_base.h"
+#include "ldtk_tileset_subset.h"
 
 #include <bn_assert.h>
 #include <bn_fixed.h>
@@ -20,6 +24,19 @@
 #include <bn_span.h>
 
 #include <algorithm>
+#include <cstdint>
+
+#if LDTK_GEN_COMPACT
+/// @cond DO_NOT_DOCUMENT
+namespace ldtk::gen::priv
+{
+
+/// @brief Project-wide pool of the entity instances, defined in `ldtk_gen_priv_layer_entity_instances.h`
+constexpr auto gen_priv_entity_pool() -> const entity*;
+
+} // namespace ldtk::gen::priv
+/// @endcond
+#endif
 
 namespace ldtk
 {
@@ -28,15 +45,54 @@ class layer
 {
 public:
     /// @cond DO_NOT_DOCUMENT
+#if LDTK_GEN_COMPACT
+    constexpr layer(const layer_definition& def, const tileset_definition* tileset_def, const bn::size& c_size,
+                    const bn::point& px_total_offset, const tile_grid_base* auto_layer_tiles,
+                    const tile_grid_base* grid_tiles, const int_grid_base* int_grid, int entity_instances_offset,
+                    int entity_instances_count, [[maybe_unused]] const ldtk::entity_table* entity_table,
+                    [[maybe_unused]] const bn::span<const entity* const>* entity_tag_index,
+                    [[maybe_unused]] const ldtk::tileset_subset* tileset_subset, gen::layer_iid iid, bool visible)
+        : _def(def), _tileset_def(tileset_def), _auto_layer_tiles(auto_layer_tiles), _grid_tiles(grid_tiles),
+          _int_grid(int_grid),
+#if LDTK_GEN_ENTITY_TABLES
+          _entity_table(entity_table),
+#endif
+#if LDTK_GEN_ENTITY_TAG_INDEX
+          _entity_tag_index(entity_tag_index),
+#endif
+#if LDTK_GEN_LEVEL_TILESETS
+          _tileset_subset(tileset_subset),
+#endif
+          _c_width(c_size.width()), _c_height(c_size.height()),
+          _px_total_offset_x(px_total_offset.x()), _px_total_offset_y(px_total_offset.y()),
+          _entity_instances_offset(entity_instances_offset), _entity_instances_count(entity_instances_count),
+          _iid(iid), _visible(visible)
+    {
+    }
+#else
     constexpr layer(const layer_definition& def, const tileset_definition* tileset_def, const bn::size& c_size,
                     const bn::point& px_total_offset, const tile_grid_base* auto_layer_tiles,
                     const tile_grid_base* grid_tiles, const int_grid_base* int_grid,
-                    const bn::span<const entity>& entity_instances, gen::layer_iid iid, bool visible)
+                    const bn::span<const entity>& entity_instances,
+                    [[maybe_unused]] const ldtk::entity_table* entity_table,
+                    [[maybe_unused]] const bn::span<const entity* const>* entity_tag_index,
+                    [[maybe_unused]] const ldtk::tileset_subset* tileset_subset, gen::layer_iid iid, bool visible)
         : _def(def), _tileset_def(tileset_def), _c_size(c_size), _px_total_offset(px_total_offset),
           _auto_layer_tiles(auto_layer_tiles), _grid_tiles(grid_tiles), _int_grid(int_grid),
-          _entity_instances(entity_instances), _iid(iid), _visible(visible)
+          _entity_instances(entity_instances),
+#if LDTK_GEN_ENTITY_TABLES
+          _entity_table(entity_table),
+#endif
+#if LDTK_GEN_ENTITY_TAG_INDEX
+          _entity_tag_index(entity_tag_index),
+#endif
+#if LDTK_GEN_LEVEL_TILESETS
+          _tileset_subset(tileset_subset),
+#endif
+          _iid(iid), _visible(visible)
     {
     }
+#endif
     /// @endcond
 
     /// @brief Deleted copy constructor.
@@ -59,8 +115,9 @@ public:
     /// @return Reference to the found entity.
     [[nodiscard]] constexpr auto find_entity(gen::entity_iid iid) const -> const entity&
     {
-        auto iter = std::ranges::find_if(_entity_instances, [iid](const entity& et) { return et.iid() == iid; });
-        BN_ASSERT(iter != _entity_instances.end(), "Entity not found with (gen::entity_iid)", (int)iid,
+        const auto entities = entity_instances();
+        auto iter = std::ranges::find_if(entities, [iid](const entity& et) { return et.iid() == iid; });
+        BN_ASSERT(iter != entities.end(), "Entity not found with (gen::entity_iid)", (int)iid,
                   " - perhaps it's an entity of different layer instance");
 
         return *iter;
@@ -79,22 +136,38 @@ public:
         return _tileset_def;
     }
 
+#if LDTK_GEN_LEVEL_TILESETS
+    /// @brief (Only *Tile layers, Auto-layers*) Part of the `tileset_def()` with only the tiles used in this level.
+    /// @note Only available when `--level-tilesets` is passed to `butano_ldtk.py`.
+    [[nodiscard]] constexpr auto tileset_subset() const -> const ldtk::tileset_subset*
+    {
+        return _tileset_subset;
+    }
+#endif
+
     /// @brief Grid-based size
+#if LDTK_GEN_COMPACT
+    [[nodiscard]] constexpr auto c_size() const -> bn::size
+    {
+        return bn::size(_c_width, _c_height);
+    }
+#else
     [[nodiscard]] constexpr auto c_size() const -> const bn::size&
     {
         return _c_size;
     }
+#endif
 
     /// @brief Grid-based width
     [[nodiscard]] constexpr auto c_width() const -> int
     {
-        return _c_size.width();
+        return c_size().width();
     }
 
     /// @brief Grid-based height
     [[nodiscard]] constexpr auto c_height() const -> int
     {
-        return _c_size.height();
+        return c_size().height();
     }
 
     /// @brief Grid size
@@ -116,10 +189,17 @@ public:
     }
 
     /// @brief Total layer pixel offset, including both instance and definition offsets.
+#if LDTK_GEN_COMPACT
+    [[nodiscard]] constexpr auto px_total_offset() const -> bn::point
+    {
+        return bn::point(_px_total_offset_x, _px_total_offset_y);
+    }
+#else
     [[nodiscard]] constexpr auto px_total_offset() const -> const bn::point&
     {
         return _px_total_offset;
     }
+#endif
 
     /// @brief Total layer X pixel offset, including both instance and definition offsets.
     [[nodiscard]] constexpr auto px_total_offset_x() const -> int
@@ -163,10 +243,48 @@ public:
     }
 
     /// @brief (Only *Entity layers*)
+#if LDTK_GEN_COMPACT
+    [[nodiscard]] constexpr auto entity_instances() const -> bn::span<const entity>
+    {
+        return bn::span<const entity>(gen::priv::gen_priv_entity_pool() + _entity_instances_offset,
+                                      _entity_instances_count);
+    }
+#else
     [[nodiscard]] constexpr auto entity_instances() const -> const bn::span<const entity>&
     {
         return _entity_instances;
     }
+#endif
+
+#if LDTK_GEN_ENTITY_TABLES
+    /// @brief (Only *Entity layers*) Structure-of-arrays view of the entity instances.
+    /// @note Only available when `--entity-tables` is passed to `butano_ldtk.py`.
+    [[nodiscard]] constexpr auto entity_table() const -> const ldtk::entity_table*
+    {
+        return _entity_table;
+    }
+#endif
+
+#if LDTK_GEN_ENTITY_TAG_INDEX
+    /// @brief (Only *Entity layers*) Entities with the tag, in the same order as the `entity_instances()`.
+    /// @note Only available when `--entity-tag-index` is passed to `butano_ldtk.py`, and any entity has a tag.
+    [[nodiscard]] constexpr auto tagged_entities(gen::entity_tag tag) const -> const bn::span<const entity* const>&
+    {
+        BN_ASSERT(_entity_tag_index, "Entity tag index not generated, pass `--entity-tag-index` to `butano_ldtk.py`");
+
+        return _entity_tag_index[static_cast<int>(tag)];
+    }
+#endif
+
+    /// @brief Checks if the `tagged_entities()` is available.
+    [[nodiscard]] constexpr auto has_entity_tag_index() const -> bool
+    {
+#if LDTK_GEN_ENTITY_TAG_INDEX
+        return _entity_tag_index != nullptr;
+#else
+        return false;
+#endif
+    }
 
     /// @brief Unique layer instance id
     [[nodiscard]] constexpr auto iid() const -> gen::layer_iid
@@ -181,6 +299,34 @@ public:
     }
 
 private:
+#if LDTK_GEN_COMPACT
+    const layer_definition& _def;
+    const tileset_definition* _tileset_def;
+
+    const tile_grid_base* _auto_layer_tiles;
+    const tile_grid_base* _grid_tiles;
+    const int_grid_base* _int_grid;
+#if LDTK_GEN_ENTITY_TABLES
+    const ldtk::entity_table* _entity_table;
+#endif
+#if LDTK_GEN_ENTITY_TAG_INDEX
+    const bn::span<const entity* const>* _entity_tag_index;
+#endif
+#if LDTK_GEN_LEVEL_TILESETS
+    const ldtk::tileset_subset* _tileset_subset;
+#endif
+
+    std::uint16_t _c_width;
+    std::uint16_t _c_height;
+    std::int16_t _px_total_offset_x;
+    std::int16_t _px_total_offset_y;
+
+    std::uint16_t _entity_instances_offset;
+    std::uint16_t _entity_instances_count;
+    gen::layer_iid _iid;
+
+    bool _visible;
+#else
     const layer_definition& _def;
     const tileset_definition* _tileset_def;
 
@@ -192,9 +338,23 @@ private:
     const int_grid_base* _int_grid;
 
     bn::span<const entity> _entity_instances;
+#if LDTK_GEN_ENTITY_TABLES
+    const ldtk::entity_table* _entity_table;
+#endif
+#if LDTK_GEN_ENTITY_TAG_INDEX
+    const bn::span<const entity* const>* _entity_tag_index;
+#endif
+#if LDTK_GEN_LEVEL_TILESETS
+    const ldtk::tileset_subset* _tileset_subset;
+#endif
     gen::layer_iid _iid;
 
     bool _visible;
+#endif
 };
 
 } // namespace ldtk
+
+#if LDTK_GEN_COMPACT
+#include "ldtk_gen_priv_layer_entity_instances.h"
+#endif
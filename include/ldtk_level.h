@@ -4,6 +4,7 @@
 #pragma once
 
 #include "ldtk_field.h"
+#include "ldtk_gen_config.h"
 #include "ldtk_gen_idents_fwd.h"
 #include "ldtk_gen_iids_fwd.h"
 #include "ldtk_layer.h"
@@ -17,6 +18,19 @@
 #include <bn_span.h>
 
 #include <algorithm>
+#include <cstdint>
+
+#if LDTK_GEN_COMPACT
+/// @cond DO_NOT_DOCUMENT
+namespace ldtk::gen::priv
+{
+
+/// @brief Project-wide pool of the level field instances, defined in `ldtk_gen_priv_level_field_instances.h`
+constexpr auto gen_priv_level_field_pool() -> const field*;
+
+} // namespace ldtk::gen::priv
+/// @endcond
+#endif
 
 namespace ldtk
 {
@@ -25,6 +39,17 @@ class level
 {
 public:
     /// @cond DO_NOT_DOCUMENT
+#if LDTK_GEN_COMPACT
+    constexpr level(bn::color bg_color, int field_instances_offset, int field_instances_count,
+                    gen::level_ident identifier, gen::level_iid iid, const bn::span<const layer>& layer_instances,
+                    const bn::size& px_size, int uid, int world_depth, const bn::point& world_coord)
+        : _layer_instances(layer_instances), _world_coord(world_coord), _uid(uid), _bg_color(bg_color),
+          _field_instances_offset(field_instances_offset), _field_instances_count(field_instances_count),
+          _px_width(px_size.width()), _px_height(px_size.height()), _world_depth(world_depth),
+          _identifier(identifier), _iid(iid)
+    {
+    }
+#else
     constexpr level(bn::color bg_color, const bn::span<const field>& field_instances, gen::level_ident identifier,
                     gen::level_iid iid, const bn::span<const layer>& layer_instances, const bn::size& px_size, int uid,
                     int world_depth, const bn::point& world_coord)
@@ -33,6 +58,7 @@ public:
           _world_coord(world_coord)
     {
     }
+#endif
     /// @endcond
 
     /// @brief Deleted copy constructor.
@@ -85,10 +111,10 @@ public:
     [[nodiscard]] constexpr auto get_field(gen::level_field_ident identifier) const -> const field&
     {
         BN_ASSERT((int)identifier >= 0, "Invalid identifier (gen::level_field_ident)", (int)identifier);
-        BN_ASSERT((int)identifier < _field_instances.size(), "Out of bound identifier (gen::level_field_ident)",
+        BN_ASSERT((int)identifier < field_instances().size(), "Out of bound identifier (gen::level_field_ident)",
                   (int)identifier);
 
-        return _field_instances.data()[(int)identifier];
+        return field_instances().data()[(int)identifier];
     }
 
 public:
@@ -124,10 +150,18 @@ public:
     }
 
     /// @brief An array containing this level custom field values.
+#if LDTK_GEN_COMPACT
+    [[nodiscard]] constexpr auto field_instances() const -> bn::span<const field>
+    {
+        return bn::span<const field>(gen::priv::gen_priv_level_field_pool() + _field_instances_offset,
+                                     _field_instances_count);
+    }
+#else
     [[nodiscard]] constexpr auto field_instances() const -> const bn::span<const field>&
     {
         return _field_instances;
     }
+#endif
 
     /// @brief User defined unique identifier
     [[nodiscard]] constexpr auto identifier() const -> gen::level_ident
@@ -149,10 +183,17 @@ public:
     }
 
     /// @brief Size of the level in pixels
+#if LDTK_GEN_COMPACT
+    [[nodiscard]] constexpr auto px_size() const -> bn::size
+    {
+        return bn::size(_px_width, _px_height);
+    }
+#else
     [[nodiscard]] constexpr auto px_size() const -> const bn::size&
     {
         return _px_size;
     }
+#endif
 
     /// @brief Width of the level in pixels
     [[nodiscard]] constexpr auto px_width() const -> int
@@ -205,6 +246,19 @@ public:
     }
 
 private:
+#if LDTK_GEN_COMPACT
+    bn::span<const layer> _layer_instances;
+    bn::point _world_coord;
+    int _uid;
+    bn::color _bg_color;
+    std::uint16_t _field_instances_offset;
+    std::uint16_t _field_instances_count;
+    std::uint16_t _px_width;
+    std::uint16_t _px_height;
+    std::int16_t _world_depth;
+    gen::level_ident _identifier;
+    gen::level_iid _iid;
+#else
     bn::color _bg_color;
     bn::span<const field> _field_instances;
     gen::level_ident _identifier;
@@ -214,6 +268,11 @@ private:
     int _uid;
     int _world_depth;
     bn::point _world_coord;
+#endif
 };
 
 } // namespace ldtk
+
+#if LDTK_GEN_COMPACT
+#include "ldtk_gen_priv_level_field_instances.h"
+#endif
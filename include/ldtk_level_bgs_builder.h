@@ -402,7 +402,8 @@ public:
 
     /// @brief Sets the tile info that fills the out-of-bound region of a level background.
     /// @note Before calling this, you @b must make sure `has_background()` returns `true`. \n
-    /// Also, you @b must use the valid tile index for the background.
+    /// Also, you @b must use the valid tile index for the background. \n
+    /// With `--level-tilesets`, the tiles not used in the level are drawn as the empty tile.
     /// @param oob_tile_info tile info to fill the out-of-bound region of a level background.
     /// @param layer_identifier identifier of the layer to set the tile info to.
     /// @return Reference to `this`.
@@ -446,7 +447,7 @@ private:
     /// @endcond
 
 private:
-    [[nodiscard]] auto dimensions() const -> const bn::size&;
+    [[nodiscard]] auto dimensions() const -> bn::size;
 
     [[nodiscard]] auto bg_attr(gen::layer_ident layer_identifier) -> bg_unique_attributes&;
 
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "ldtk_gen_idents_fwd.h"
+
+#include <bn_assert.h>
+#include <bn_config_bgs.h>
+#include <bn_optional.h>
+#include <bn_vector.h>
+
+#include <cstdint>
+
+/// @brief Enables the counters of the level backgrounds, which you can get with `ldtk::core::stats()`. \n
+/// It costs a hardware timer read per frame and about 1 KB of EWRAM, so it's disabled by default.
+#ifndef LDTK_CFG_STATS_ENABLED
+    #define LDTK_CFG_STATS_ENABLED false
+#endif
+
+/// @brief Number of the last frames kept in `ldtk::level_bgs_stats`.
+#ifndef LDTK_CFG_STATS_MAX_FRAMES
+    #define LDTK_CFG_STATS_MAX_FRAMES 16
+#endif
+
+namespace ldtk
+{
+
+/// @brief Why all the cells of a layer background were reloaded.
+enum class reload_reason : std::uint8_t
+{
+    SET_LEVEL,    ///< Background was created (`level::create_bgs()` or `level_bgs_ptr::set_level()`)
+    FORCE_RELOAD, ///< Out-of-bound tile was changed
+    BIG_JUMP,     ///< Background moved a screen or more in a frame
+    VISIBILITY,   ///< Hidden background was shown again
+};
+
+/// @brief Number of the `reload_reason` values.
+inline constexpr int reload_reasons_count = 4;
+
+/// @brief Counters of a layer background in a frame.
+struct layer_frame_stats
+{
+    gen::layer_ident layer_identifier{}; ///< Layer of the background
+    int cells = 0;                       ///< Map cells rewritten
+    bn::optional<reload_reason> reload;  ///< Why all the cells were reloaded, if they were
+};
+
+/// @brief Counters of all the level backgrounds in a frame.
+struct frame_stats
+{
+    int cells = 0;         ///< Map cells rewritten
+    int reloads = 0;       ///< Backgrounds with all of their cells reloaded
+    int vram_bytes = 0;    ///< Bytes of the map cells committed to VRAM
+    int update_cycles = 0; ///< CPU cycles spent in the update callback of butano-ldtk, with 64 cycles precision
+
+    /// @brief Counters of each layer background, in the creation order of the backgrounds.
+    bn::vector<layer_frame_stats, BN_CFG_BGS_MAX_ITEMS> layers;
+};
+
+/// @brief Counters since `ldtk::core::init()` or `ldtk::core::reset_stats()`.
+struct total_stats
+{
+    int frames = 0;                         ///< Frames counted
+    std::int64_t cells = 0;                 ///< Map cells rewritten
+    int reloads[reload_reasons_count] = {}; ///< Full reloads of backgrounds, indexed by `reload_reason`
+    std::int64_t vram_bytes = 0;            ///< Bytes of the map cells committed to VRAM
+    std::int64_t update_cycles = 0;         ///< CPU cycles spent in the update callback of butano-ldtk
+    int max_update_cycles = 0;              ///< The most CPU cycles spent in the update callback in a frame
+};
+
+/// @brief Counters of the level backgrounds, with the last `max_frames` frames kept in a ring buffer.
+/// @note Only available when `LDTK_CFG_STATS_ENABLED` is `true`.
+class level_bgs_stats
+{
+public:
+    /// @brief Number of the last frames kept.
+    static constexpr int max_frames = LDTK_CFG_STATS_MAX_FRAMES;
+
+    static_assert(max_frames > 0, "Invalid LDTK_CFG_STATS_MAX_FRAMES");
+
+public:
+    /// @brief Counters since `ldtk::core::init()` or `ldtk::core::reset_stats()`.
+    [[nodiscard]] constexpr auto total() const -> const total_stats&
+    {
+        return _total;
+    }
+
+    /// @brief Number of the frames kept, up to `max_frames`.
+    [[nodiscard]] constexpr auto frames_count() const -> int
+    {
+        return _frames_count;
+    }
+
+    /// @brief Get the counters of a kept frame.
+    /// @param age `0` for the last frame, `1` for the one before it, and so on.
+    [[nodiscard]] constexpr auto frame(int age) const -> const frame_stats&
+    {
+        BN_ASSERT(age >= 0 && age < _frames_count, "Invalid age: ", age, " [0..", _frames_count, ")");
+
+        int index = _next_index - 1 - age;
+        if (index < 0)
+            index += max_frames;
+
+        return _frames[index];
+    }
+
+public:
+    /// @cond DO_NOT_DOCUMENT
+    void push_frame(const frame_stats& frame)
+    {
+        _frames[_next_index] = frame;
+        _next_index = (_next_index + 1 == max_frames) ? 0 : _next_index + 1;
+        if (_frames_count < max_frames)
+            ++_frames_count;
+
+        ++_total.frames;
+        _total.cells += frame.cells;
+        for (const layer_frame_stats& layer : frame.layers)
+        {
+            if (layer.reload)
+                ++_total.reloads[static_cast<int>(*layer.reload)];
+        }
+        _total.vram_bytes += frame.vram_bytes;
+        _total.update_cycles += frame.update_cycles;
+        if (_total.max_update_cycles < frame.update_cycles)
+            _total.max_update_cycles = frame.update_cycles;
+    }
+    /// @endcond
+
+private:
+    total_stats _total;
+    frame_stats _frames[max_frames];
+    int _next_index = 0;
+    int _frames_count = 0;
+};
+
+} // namespace ldtk
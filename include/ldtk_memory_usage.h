@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+namespace ldtk
+{
+
+/// @brief EWRAM used by the level backgrounds, which you can get with `ldtk::core::memory_usage()`. \n
+/// All of it is reserved by `ldtk::core::init()`, so `total_bytes` is the same whether the pools are used or not.
+struct memory_usage
+{
+    int bgs_count = 0;        ///< Layer backgrounds in use, out of `max_bgs_count`
+    int max_bgs_count = 0;    ///< Capacity of the layer backgrounds pool (`BN_CFG_BGS_MAX_ITEMS`)
+    int levels_count = 0;     ///< `ldtk::level_bgs_ptr`s in use, out of `max_levels_count`
+    int max_levels_count = 0; ///< Capacity of the level backgrounds pool (`BN_CFG_BGS_MAX_ITEMS`)
+
+    int bg_bytes = 0;    ///< Bytes of a layer background, including its map cells buffer
+    int cells_bytes = 0; ///< Bytes of the map cells buffer of a layer background
+    int level_bytes = 0; ///< Bytes of a `ldtk::level_bgs_ptr`
+    int total_bytes = 0; ///< Bytes reserved by `ldtk::core::init()`, including the pools
+
+    /// @brief Bytes of the pools in use.
+    [[nodiscard]] constexpr auto used_bytes() const -> int
+    {
+        return bgs_count * bg_bytes + levels_count * level_bytes;
+    }
+};
+
+} // namespace ldtk
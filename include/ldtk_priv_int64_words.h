@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+/// @cond DO_NOT_DOCUMENT
+
+namespace ldtk::priv
+{
+
+/// @brief 64-bit integer that's stored in the `field` as two 32-bit words.
+/// @details This keeps the alignment of the `field` to 4 bytes in the compact generation mode.
+template <typename Int>
+    requires(std::is_integral_v<Int> && sizeof(Int) == 8)
+class int64_words
+{
+private:
+    std::uint32_t _low;
+    std::uint32_t _high;
+
+public:
+    constexpr int64_words(Int value)
+        : _low(static_cast<std::uint32_t>(static_cast<std::uint64_t>(value))),
+          _high(static_cast<std::uint32_t>(static_cast<std::uint64_t>(value) >> 32))
+    {
+    }
+
+public:
+    [[nodiscard]] constexpr operator Int() const
+    {
+        return static_cast<Int>((static_cast<std::uint64_t>(_high) << 32) | _low);
+    }
+};
+
+} // namespace ldtk::priv
+
+/// @endcond
@@ -70,6 +70,35 @@ public:
     }
 };
 
+/// @brief Optional enum span that's stored in the `field` without `bn::type_id_t`
+/// @details Used in the compact generation mode, as the `field_definition` already has the enum type.
+class optional_untyped_enum_span
+{
+private:
+    const void* _optional_span_begin;
+    const void* _optional_span_end;
+
+public:
+    template <typename Enum>
+        requires std::is_scoped_enum_v<Enum>
+    constexpr optional_untyped_enum_span(bn::span<const bn::optional<Enum>> span)
+        : _optional_span_begin(span.data()), _optional_span_end(span.data() + span.size())
+    {
+    }
+
+public:
+    /// @brief Extract the concrete optional enum span from this optional untyped enum span.
+    /// @tparam Enum Type of the enum to be extracted.
+    /// @note It's up to the caller to check the type of the enum.
+    template <typename Enum>
+        requires std::is_scoped_enum_v<Enum>
+    [[nodiscard]] constexpr auto get() const -> bn::span<const bn::optional<Enum>>
+    {
+        return bn::span<const bn::optional<Enum>>(static_cast<const bn::optional<Enum>*>(_optional_span_begin),
+                                                  static_cast<const bn::optional<Enum>*>(_optional_span_end));
+    }
+};
+
 } // namespace ldtk::priv
 
 /// @endcond
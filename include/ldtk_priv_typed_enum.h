@@ -70,6 +70,39 @@ public:
     }
 };
 
+/// @brief Enum value that's stored in the `field` without `bn::type_id_t`
+/// @details Used in the compact generation mode, as the `field_definition` already has the enum type.
+class untyped_enum
+{
+private:
+    int _number;
+
+public:
+    template <typename Enum>
+        requires std::is_scoped_enum_v<Enum>
+    constexpr untyped_enum(Enum raw) : _number(static_cast<decltype(_number)>(raw))
+    {
+    }
+
+public:
+    /// @brief Extract the concrete enum from this untyped enum.
+    /// @tparam Enum Type of the enum to be extracted.
+    /// @note It's up to the caller to check the type of the enum.
+    template <typename Enum>
+        requires std::is_scoped_enum_v<Enum>
+    [[nodiscard]] constexpr auto get() const -> Enum
+    {
+        return static_cast<Enum>(_number);
+    }
+
+public:
+    /// @brief Numeric value of the enum
+    [[nodiscard]] constexpr auto number() const -> decltype(_number)
+    {
+        return _number;
+    }
+};
+
 } // namespace ldtk::priv
 
 /// @endcond
@@ -67,6 +67,34 @@ public:
     }
 };
 
+/// @brief Enum span that's stored in the `field` without `bn::type_id_t`
+/// @details Used in the compact generation mode, as the `field_definition` already has the enum type.
+class untyped_enum_span
+{
+private:
+    const void* _span_begin;
+    const void* _span_end;
+
+public:
+    template <typename Enum>
+        requires std::is_scoped_enum_v<Enum>
+    constexpr untyped_enum_span(bn::span<const Enum> span)
+        : _span_begin(span.data()), _span_end(span.data() + span.size())
+    {
+    }
+
+public:
+    /// @brief Extract the concrete enum span from this untyped enum span.
+    /// @tparam Enum Type of the enum to be extracted.
+    /// @note It's up to the caller to check the type of the enum.
+    template <typename Enum>
+        requires std::is_scoped_enum_v<Enum>
+    [[nodiscard]] constexpr auto get() const -> bn::span<const Enum>
+    {
+        return bn::span<const Enum>(static_cast<const Enum*>(_span_begin), static_cast<const Enum*>(_span_end));
+    }
+};
+
 } // namespace ldtk::priv
 
 /// @endcond
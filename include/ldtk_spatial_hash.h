@@ -0,0 +1,397 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "ldtk_entity.h"
+#include "ldtk_layer.h"
+
+#include <bn_assert.h>
+#include <bn_fixed.h>
+#include <bn_fixed_point.h>
+#include <bn_fixed_size.h>
+#include <bn_math.h>
+#include <bn_top_left_fixed_rect.h>
+
+#include <bit>
+#include <cstdint>
+
+/// @cond DO_NOT_DOCUMENT
+namespace ldtk::priv
+{
+
+[[nodiscard]] constexpr auto default_spatial_hash_buckets_count(int max_actors) -> int
+{
+    const int buckets_count = static_cast<int>(std::bit_ceil(static_cast<unsigned>(max_actors * 2)));
+    return (buckets_count < 16) ? 16 : buckets_count;
+}
+
+} // namespace ldtk::priv
+/// @endcond
+
+namespace ldtk
+{
+
+/// @brief Fixed-capacity uniform spatial hash for the broadphase of actor-vs-actor checks.
+/// @details Space is divided into square buckets, and each actor is linked to every bucket its rect touches. \n
+/// Queries only visit the buckets overlapping the query rect,
+/// so the cost grows with the number of nearby actors instead of the total number of actors. \n
+/// Everything is stored inline; No heap allocation at all.
+/// @tparam MaxActors Maximum number of actors that can be inserted at once.
+/// @tparam MaxCells Maximum number of (actor, bucket) links. \n
+/// An actor not bigger than a bucket touches up to 4 buckets.
+/// @tparam BucketsCount Number of hash buckets. Must be a power of two.
+template <int MaxActors, int MaxCells = MaxActors * 4,
+          int BucketsCount = priv::default_spatial_hash_buckets_count(MaxActors)>
+class spatial_hash
+{
+    static_assert(MaxActors > 0 && MaxActors <= INT16_MAX, "Invalid MaxActors");
+    static_assert(MaxCells >= MaxActors && MaxCells <= INT16_MAX, "Invalid MaxCells");
+    static_assert(BucketsCount > 0 && std::has_single_bit(static_cast<unsigned>(BucketsCount)),
+                  "BucketsCount must be power of two");
+
+public:
+    /// @brief Creates an empty spatial hash.
+    /// @param bucket_size Width and height of a bucket in pixels.
+    constexpr explicit spatial_hash(int bucket_size)
+        : _bucket_size(bucket_size),
+          _bucket_shift(std::has_single_bit(static_cast<unsigned>(bucket_size))
+                            ? std::countr_zero(static_cast<unsigned>(bucket_size))
+                            : -1)
+    {
+        BN_ASSERT(bucket_size > 0, "Invalid bucket_size: ", bucket_size);
+
+        clear();
+    }
+
+    /// @brief Creates an empty spatial hash, whose bucket size is the grid size of the layer.
+    constexpr explicit spatial_hash(const layer& layer) : spatial_hash(layer.grid_size())
+    {
+    }
+
+public:
+    /// @brief Maximum number of actors.
+    [[nodiscard]] static constexpr auto max_size() -> int
+    {
+        return MaxActors;
+    }
+
+    /// @brief Number of inserted actors.
+    [[nodiscard]] constexpr auto size() const -> int
+    {
+        return _actors_count;
+    }
+
+    /// @brief Indicates if there's no actor.
+    [[nodiscard]] constexpr auto empty() const -> bool
+    {
+        return _actors_count == 0;
+    }
+
+    /// @brief Indicates if no more actors can be inserted.
+    [[nodiscard]] constexpr auto full() const -> bool
+    {
+        return _actors_count == MaxActors;
+    }
+
+    /// @brief Width and height of a bucket in pixels.
+    [[nodiscard]] constexpr auto bucket_size() const -> int
+    {
+        return _bucket_size;
+    }
+
+    /// @brief Returns the rect of the actor.
+    [[nodiscard]] constexpr auto rect(int id) const -> const bn::top_left_fixed_rect&
+    {
+        BN_ASSERT(_contains(id), "Invalid id: ", id);
+
+        return _actors[id].rect;
+    }
+
+public:
+    /// @brief Inserts an actor.
+    /// @return Id of the inserted actor, which is valid until it's erased.
+    constexpr auto insert(const bn::top_left_fixed_rect& rect) -> int
+    {
+        BN_ASSERT(!full(), "Spatial hash is full: ", MaxActors);
+
+        const int id = _free_actor;
+        actor& act = _actors[id];
+        _free_actor = act.next_free;
+        act.next_free = USED;
+        act.first_cell = NONE;
+        ++_actors_count;
+
+        act.rect = rect;
+        _link(id);
+
+        return id;
+    }
+
+    /// @brief Inserts an actor, seeded from the `px()`, `size()` and `pivot()` of the entity.
+    /// @return Id of the inserted actor, which is valid until it's erased.
+    constexpr auto insert(const entity& entity) -> int
+    {
+        return insert(entity_rect(entity));
+    }
+
+    /// @brief Moves an actor to the new rect.
+    /// @note Links to the buckets are only rebuilt when the rect touches a different set of buckets.
+    constexpr void update(int id, const bn::top_left_fixed_rect& rect)
+    {
+        BN_ASSERT(_contains(id), "Invalid id: ", id);
+
+        actor& act = _actors[id];
+        const cell_range old_range = _range(act.rect);
+        act.rect = rect;
+
+        if (_range(rect) != old_range)
+        {
+            _unlink(id);
+            _link(id);
+        }
+    }
+
+    /// @brief Moves an actor to the new top-left position, keeping its dimensions.
+    constexpr void update(int id, const bn::fixed_point& top_left_position)
+    {
+        update(id, bn::top_left_fixed_rect(top_left_position, rect(id).dimensions()));
+    }
+
+    /// @brief Erases an actor.
+    constexpr void erase(int id)
+    {
+        BN_ASSERT(_contains(id), "Invalid id: ", id);
+
+        _unlink(id);
+
+        actor& act = _actors[id];
+        act.next_free = _free_actor;
+        _free_actor = static_cast<std::int16_t>(id);
+        --_actors_count;
+    }
+
+    /// @brief Erases all actors.
+    constexpr void clear()
+    {
+        for (std::int16_t& head : _bucket_heads)
+            head = NONE;
+
+        for (int i = 0; i < MaxActors; ++i)
+            _actors[i].next_free = static_cast<std::int16_t>((i + 1 < MaxActors) ? i + 1 : NONE);
+        _free_actor = 0;
+        _actors_count = 0;
+
+        for (int i = 0; i < MaxCells; ++i)
+            _cells[i].next_in_bucket = static_cast<std::int16_t>((i + 1 < MaxCells) ? i + 1 : NONE);
+        _free_cell = 0;
+    }
+
+public:
+    /// @brief Calls `fn(id)` once for each actor whose rect intersects with the given rect.
+    template <typename Fn>
+    constexpr void query(const bn::top_left_fixed_rect& rect, Fn&& fn) const
+    {
+        const cell_range range = _range(rect);
+
+        for (int cy = range.min_y; cy <= range.max_y; ++cy)
+        {
+            for (int cx = range.min_x; cx <= range.max_x; ++cx)
+            {
+                for (int c = _bucket_heads[_bucket(cx, cy)]; c != NONE; c = _cells[c].next_in_bucket)
+                {
+                    const cell& cel = _cells[c];
+                    if (cel.x != cx || cel.y != cy)
+                        continue;
+
+                    const bn::top_left_fixed_rect& actor_rect = _actors[cel.actor].rect;
+                    if (!actor_rect.intersects(rect))
+                        continue;
+
+                    // Report the actor only in the first bucket it shares with the query rect,
+                    // as it might be linked to multiple buckets.
+                    const cell_range actor_range = _range(actor_rect);
+                    if (cx != bn::max(actor_range.min_x, range.min_x) || cy != bn::max(actor_range.min_y, range.min_y))
+                        continue;
+
+                    fn(static_cast<int>(cel.actor));
+                }
+            }
+        }
+    }
+
+    /// @brief Calls `fn(id_a, id_b)` once for each pair of actors whose rects intersect with each other.
+    template <typename Fn>
+    constexpr void for_each_pair(Fn&& fn) const
+    {
+        for (int bucket = 0; bucket < BucketsCount; ++bucket)
+        {
+            for (int c1 = _bucket_heads[bucket]; c1 != NONE; c1 = _cells[c1].next_in_bucket)
+            {
+                const cell& cel1 = _cells[c1];
+                const bn::top_left_fixed_rect& rect1 = _actors[cel1.actor].rect;
+
+                for (int c2 = cel1.next_in_bucket; c2 != NONE; c2 = _cells[c2].next_in_bucket)
+                {
+                    const cell& cel2 = _cells[c2];
+                    if (cel2.x != cel1.x || cel2.y != cel1.y)
+                        continue;
+
+                    const bn::top_left_fixed_rect& rect2 = _actors[cel2.actor].rect;
+                    if (!rect1.intersects(rect2))
+                        continue;
+
+                    // Report the pair only in the bucket containing the top-left of their intersection,
+                    // as they might share multiple buckets.
+                    if (_to_cell(bn::max(rect1.left(), rect2.left()).floor_integer()) != cel1.x ||
+                        _to_cell(bn::max(rect1.top(), rect2.top()).floor_integer()) != cel1.y)
+                        continue;
+
+                    fn(static_cast<int>(cel1.actor), static_cast<int>(cel2.actor));
+                }
+            }
+        }
+    }
+
+public:
+    /// @brief Returns the rect of the entity, from its `px()`, `size()` and `pivot()`.
+    [[nodiscard]] static constexpr auto entity_rect(const entity& entity) -> bn::top_left_fixed_rect
+    {
+        const bn::fixed_point top_left(bn::fixed(entity.px().x()) - entity.width() * entity.pivot().x(),
+                                       bn::fixed(entity.px().y()) - entity.height() * entity.pivot().y());
+
+        return bn::top_left_fixed_rect(top_left, bn::fixed_size(entity.width(), entity.height()));
+    }
+
+private:
+    static constexpr std::int16_t NONE = -1;
+    static constexpr std::int16_t USED = -2;
+
+    struct cell_range
+    {
+        int min_x;
+        int min_y;
+        int max_x;
+        int max_y;
+
+        constexpr bool operator==(const cell_range&) const = default;
+    };
+
+    struct actor
+    {
+        bn::top_left_fixed_rect rect;
+        std::int16_t first_cell = NONE;
+        std::int16_t next_free = NONE;
+    };
+
+    struct cell
+    {
+        std::int16_t x = 0;
+        std::int16_t y = 0;
+        std::int16_t actor = NONE;
+        std::int16_t prev_in_bucket = NONE;
+        std::int16_t next_in_bucket = NONE;
+        std::int16_t next_of_actor = NONE;
+    };
+
+private:
+    [[nodiscard]] constexpr bool _contains(int id) const
+    {
+        return id >= 0 && id < MaxActors && _actors[id].next_free == USED;
+    }
+
+    [[nodiscard]] constexpr int _to_cell(int px) const
+    {
+        if (_bucket_shift >= 0)
+            return px >> _bucket_shift;
+
+        const int quotient = px / _bucket_size;
+        return (px % _bucket_size < 0) ? quotient - 1 : quotient;
+    }
+
+    [[nodiscard]] constexpr auto _range(const bn::top_left_fixed_rect& rect) const -> cell_range
+    {
+        const int min_x = _to_cell(rect.left().floor_integer());
+        const int min_y = _to_cell(rect.top().floor_integer());
+        const int max_x = _to_cell(rect.right().ceil_integer() - 1);
+        const int max_y = _to_cell(rect.bottom().ceil_integer() - 1);
+
+        return cell_range{min_x, min_y, bn::max(min_x, max_x), bn::max(min_y, max_y)};
+    }
+
+    [[nodiscard]] static constexpr int _bucket(int cx, int cy)
+    {
+        const unsigned hash = (static_cast<unsigned>(cx) * 73856093u) ^ (static_cast<unsigned>(cy) * 19349663u);
+        return static_cast<int>(hash & static_cast<unsigned>(BucketsCount - 1));
+    }
+
+    constexpr void _link(int id)
+    {
+        actor& act = _actors[id];
+        const cell_range range = _range(act.rect);
+
+        for (int cy = range.min_y; cy <= range.max_y; ++cy)
+        {
+            for (int cx = range.min_x; cx <= range.max_x; ++cx)
+            {
+                BN_ASSERT(_free_cell != NONE, "Spatial hash cells are full: ", MaxCells);
+
+                const int c = _free_cell;
+                cell& cel = _cells[c];
+                _free_cell = cel.next_in_bucket;
+
+                const int bucket = _bucket(cx, cy);
+                cel.x = static_cast<std::int16_t>(cx);
+                cel.y = static_cast<std::int16_t>(cy);
+                cel.actor = static_cast<std::int16_t>(id);
+                cel.prev_in_bucket = NONE;
+                cel.next_in_bucket = _bucket_heads[bucket];
+                if (cel.next_in_bucket != NONE)
+                    _cells[cel.next_in_bucket].prev_in_bucket = static_cast<std::int16_t>(c);
+                _bucket_heads[bucket] = static_cast<std::int16_t>(c);
+
+                cel.next_of_actor = act.first_cell;
+                act.first_cell = static_cast<std::int16_t>(c);
+            }
+        }
+    }
+
+    constexpr void _unlink(int id)
+    {
+        actor& act = _actors[id];
+
+        for (int c = act.first_cell; c != NONE;)
+        {
+            cell& cel = _cells[c];
+            const int next_of_actor = cel.next_of_actor;
+
+            if (cel.prev_in_bucket != NONE)
+                _cells[cel.prev_in_bucket].next_in_bucket = cel.next_in_bucket;
+            else
+                _bucket_heads[_bucket(cel.x, cel.y)] = cel.next_in_bucket;
+            if (cel.next_in_bucket != NONE)
+                _cells[cel.next_in_bucket].prev_in_bucket = cel.prev_in_bucket;
+
+            cel.actor = NONE;
+            cel.next_in_bucket = _free_cell;
+            _free_cell = static_cast<std::int16_t>(c);
+
+            c = next_of_actor;
+        }
+
+        act.first_cell = NONE;
+    }
+
+private:
+    actor _actors[MaxActors];
+    cell _cells[MaxCells];
+    std::int16_t _bucket_heads[BucketsCount] = {};
+
+    int _bucket_size;
+    int _bucket_shift;
+    int _actors_count = 0;
+    std::int16_t _free_actor = 0;
+    std::int16_t _free_cell = 0;
+};
+
+} // namespace ldtk
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "ldtk_gen_config.h"
+#include "ldtk_gen_tags_fwd.h"
+
+#include <concepts>
+
+namespace ldtk
+{
+
+/// @brief Bitmask of entity tags; Bit `n` is set if the entity tag of value `n` is included.
+using entity_tag_mask = gen::priv::entity_tag_mask_type;
+
+/// @brief Bitmask of tileset tags; Bit `n` is set if the tileset tag of value `n` is included.
+using tileset_tag_mask = gen::priv::tileset_tag_mask_type;
+
+/// @brief Returns the bitmask of the given entity tags.
+template <std::same_as<gen::entity_tag>... Tags>
+[[nodiscard]] constexpr auto tag_mask(gen::entity_tag tag, Tags... tags) -> entity_tag_mask
+{
+    return static_cast<entity_tag_mask>(static_cast<entity_tag_mask>(1) << static_cast<int>(tag)) |
+           (static_cast<entity_tag_mask>(0) | ... | tag_mask(tags));
+}
+
+/// @brief Returns the bitmask of the given tileset tags.
+template <std::same_as<gen::tileset_tag>... Tags>
+[[nodiscard]] constexpr auto tag_mask(gen::tileset_tag tag, Tags... tags) -> tileset_tag_mask
+{
+    return static_cast<tileset_tag_mask>(static_cast<tileset_tag_mask>(1) << static_cast<int>(tag)) |
+           (static_cast<tileset_tag_mask>(0) | ... | tag_mask(tags));
+}
+
+} // namespace ldtk
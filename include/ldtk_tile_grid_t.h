@@ -66,6 +66,11 @@ public:
         BN_ASSERT(c_width * c_height == grid.size(), "Invalid grid dimensions: ", c_width, "x", c_height,
                   ", != ", grid.size());
     }
+
+    // User-provided, as GCC 12 can't use the implicit constexpr virtual destructor in a constant expression.
+    constexpr ~tile_grid_t() override
+    {
+    }
     /// @endcond
 
     /// @brief Get whether the cell storage is bloated (`u16`) or not (`u8`).
@@ -8,6 +8,7 @@
 
 #include "ldtk_gen_idents_fwd.h"
 #include "ldtk_gen_tags_fwd.h"
+#include "ldtk_tag_mask.h"
 
 #include <bn_assert.h>
 #include <bn_optional.h>
@@ -28,10 +29,10 @@ public:
     constexpr tileset_definition(const bn::regular_bg_item& bg_item, int tiles_count,
                                  bn::span<const tileset_custom_data> custom_data,
                                  bn::span<const tileset_enum_tag> enum_tags, gen::tileset_ident identifier,
-                                 bn::span<const gen::tileset_tag> tags, bn::optional<bn::type_id_t> tags_source_enum_id,
-                                 int tile_grid_size, int uid)
+                                 bn::span<const gen::tileset_tag> tags, tileset_tag_mask tag_mask,
+                                 bn::optional<bn::type_id_t> tags_source_enum_id, int tile_grid_size, int uid)
         : _bg_item(bg_item), _tiles_count(tiles_count), _custom_data(custom_data), _enum_tags(enum_tags),
-          _identifier(identifier), _tags(tags), _tags_source_enum_id(tags_source_enum_id),
+          _identifier(identifier), _tags(tags), _tag_mask(tag_mask), _tags_source_enum_id(tags_source_enum_id),
           _tile_grid_size(tile_grid_size), _uid(uid)
     {
     }
@@ -116,6 +117,30 @@ public:
         return _tags;
     }
 
+    /// @brief Bitmask of the `tags()`
+    [[nodiscard]] constexpr auto tag_mask() const -> tileset_tag_mask
+    {
+        return _tag_mask;
+    }
+
+    /// @brief Checks if this tileset has the tag, in O(1).
+    [[nodiscard]] constexpr auto has_tag(gen::tileset_tag tag) const -> bool
+    {
+        return has_any_tags(ldtk::tag_mask(tag));
+    }
+
+    /// @brief Checks if this tileset has any of the tags in the mask, in O(1).
+    [[nodiscard]] constexpr auto has_any_tags(tileset_tag_mask mask) const -> bool
+    {
+        return (_tag_mask & mask) != 0;
+    }
+
+    /// @brief Checks if this tileset has all of the tags in the mask, in O(1).
+    [[nodiscard]] constexpr auto has_all_tags(tileset_tag_mask mask) const -> bool
+    {
+        return (_tag_mask & mask) == mask;
+    }
+
     /// @brief Optional Enum definition ID used for this tileset meta-data
     [[nodiscard]] constexpr auto tags_source_enum_id() const -> const bn::optional<bn::type_id_t>&
     {
@@ -141,6 +166,7 @@ private:
     bn::span<const tileset_enum_tag> _enum_tags;
     gen::tileset_ident _identifier;
     bn::span<const gen::tileset_tag> _tags;
+    tileset_tag_mask _tag_mask;
     bn::optional<bn::type_id_t> _tags_source_enum_id;
     int _tile_grid_size;
     int _uid;
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+// SPDX-License-Identifier: Zlib
+
+#pragma once
+
+#include "ldtk_tile_index.h"
+
+#include <bn_assert.h>
+#include <bn_regular_bg_item.h>
+#include <bn_span.h>
+
+namespace ldtk
+{
+
+/// @brief Part of a tileset with only the tiles used in a level,
+/// so that the level backgrounds don't upload the whole tileset to VRAM.
+class tileset_subset
+{
+public:
+    /// @cond DO_NOT_DOCUMENT
+    constexpr tileset_subset(const bn::regular_bg_item& bg_item, const bn::span<const tile_index>& tile_remap)
+        : _bg_item(bg_item), _tile_remap(tile_remap)
+    {
+    }
+    /// @endcond
+
+    /// @brief Deleted copy constructor.
+    constexpr tileset_subset(const tileset_subset&) = delete;
+
+    /// @brief Deleted copy assignment operator.
+    constexpr tileset_subset& operator=(const tileset_subset&) = delete;
+
+    /// @brief Defaulted move constructor.
+    constexpr tileset_subset(tileset_subset&&) = default;
+
+    /// @brief Defaulted move assignment operator.
+    constexpr tileset_subset& operator=(tileset_subset&&) = default;
+
+public:
+    /// @brief Converts the tile index of the tileset to the tile index of the `bg_item()`.
+    /// @note Tiles not used in the level are converted to the empty tile index `0`.
+    [[nodiscard]] constexpr auto subset_tile_index(tile_index tile_id) const -> tile_index
+    {
+        BN_ASSERT(tile_id < _tile_remap.size(), "Out of bound tile index: ", tile_id);
+
+        return _tile_remap.data()[tile_id];
+    }
+
+public:
+    /// @brief Background item with only the tiles used in the level
+    [[nodiscard]] constexpr auto bg_item() const -> const bn::regular_bg_item&
+    {
+        return _bg_item;
+    }
+
+    /// @brief Tile index of the `bg_item()` for each tile index of the tileset
+    [[nodiscard]] constexpr auto tile_remap() const -> const bn::span<const tile_index>&
+    {
+        return _tile_remap;
+    }
+
+private:
+    const bn::regular_bg_item& _bg_item;
+    bn::span<const tile_index> _tile_remap;
+};
+
+} // namespace ldtk
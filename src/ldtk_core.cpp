@@ -13,4 +13,21 @@ void init()
     level_bgs_manager::init();
 }
 
+auto memory_usage() -> ldtk::memory_usage
+{
+    return level_bgs_manager::memory_usage();
+}
+
+#if LDTK_CFG_STATS_ENABLED
+auto stats() -> const level_bgs_stats&
+{
+    return level_bgs_manager::stats();
+}
+
+void reset_stats()
+{
+    level_bgs_manager::reset_stats();
+}
+#endif
+
 } // namespace ldtk::core
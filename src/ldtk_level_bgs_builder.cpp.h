@@ -249,7 +249,7 @@ auto level_bgs_builder::release_build_optional() -> bn::optional<level_bgs_ptr>
     return level_bgs_ptr::create_optional(std::move(*this));
 }
 
-auto level_bgs_builder::dimensions() const -> const bn::size&
+auto level_bgs_builder::dimensions() const -> bn::size
 {
     return _level.px_size();
 }
@@ -8,8 +8,10 @@
 
 #include "ldtk_gen_idents_fwd.h"
 #include "ldtk_layer.h"
+#include "ldtk_tile_index.h"
 #include "ldtk_tile_grid_t.h"
 #include "ldtk_tileset_definition.h"
+#include "ldtk_tileset_subset.h"
 
 #include <bn_assert.h>
 #include <bn_bgs.h>
@@ -22,6 +24,7 @@
 #include <bn_point.h>
 #include <bn_pool.h>
 #include <bn_regular_bg_builder.h>
+#include <bn_regular_bg_item.h>
 #include <bn_regular_bg_map_cell.h>
 #include <bn_regular_bg_map_cell_info.h>
 #include <bn_regular_bg_map_item.h>
@@ -29,6 +32,10 @@
 #include <bn_regular_bg_ptr.h>
 #include <bn_vector.h>
 
+#if LDTK_CFG_STATS_ENABLED
+    #include <bn_timer.h>
+#endif
+
 #include "ldtk_div_utils.h"
 
 #include <algorithm>
@@ -57,6 +64,20 @@ struct bg_t
 
     tile_grid_base::tile_info oob_tile;
 
+    const bn::regular_bg_item& tileset_bg_item;
+    const bn::regular_bg_map_cell* tileset_cells;
+#if LDTK_GEN_LEVEL_TILESETS
+    const tile_index* tile_remap; // `nullptr` if the whole tileset is used
+#endif
+
+#if LDTK_CFG_STATS_ENABLED
+    // Counters of the current frame, collected by `update_callback()`,
+    // declared before `bg_ptr` as its initialization counts the first full reload
+    int stats_cells = 0;
+    bn::optional<reload_reason> stats_reload;
+    bool stats_committed = false; // Whether the whole canvas is committed to VRAM, even if no cell is rewritten
+#endif
+
     alignas(int) bn::regular_bg_map_cell cells[ROWS * COLUMNS];
     bn::regular_bg_map_item map_item;
     bn::regular_bg_ptr bg_ptr;
@@ -69,10 +90,10 @@ struct bg_t
 private:
     void update_camera_applied_position(const bn::fixed_point& cam_applied_pos);
 
-    void update_all_cells(const bn::fixed_point& cam_applied_pos);
+    void update_all_cells(const bn::fixed_point& cam_applied_pos, reload_reason reason);
     void update_part_cells(const bn::fixed_point& next_cam_applied_pos, const bn::fixed_point& prev_cam_applied_pos);
 
-    void reset_all_cells(const bn::fixed_point& final_pos);
+    void reset_all_cells(const bn::fixed_point& final_pos, reload_reason reason);
     void reset_part_cells(const bn::fixed_point& next_final_pos, const bn::fixed_point& prev_final_pos);
 
     void reset_rows(const int level_8x8_first_y, const int level_8x8_last_y, const int level_8x8_first_x,
@@ -83,6 +104,36 @@ private:
     auto init_bg_ptr(const layer& layer_, const bn::fixed_point& cam_applied_pos, const level_bgs_builder&)
         -> bn::regular_bg_ptr;
 
+    auto remap_tile_index(int tile_idx) const -> int
+    {
+#if LDTK_GEN_LEVEL_TILESETS
+        return tile_remap ? tile_remap[tile_idx] : tile_idx;
+#else
+        return tile_idx;
+#endif
+    }
+
+    void count_stats_cells([[maybe_unused]] int cells)
+    {
+#if LDTK_CFG_STATS_ENABLED
+        stats_cells += cells;
+#endif
+    }
+
+    void count_stats_reload([[maybe_unused]] reload_reason reason)
+    {
+#if LDTK_CFG_STATS_ENABLED
+        stats_reload = reason;
+#endif
+    }
+
+    void count_stats_commit()
+    {
+#if LDTK_CFG_STATS_ENABLED
+        stats_committed = true;
+#endif
+    }
+
     auto apply_layer_diff(const bn::fixed_point& cam_applied_pos) const -> bn::fixed_point
     {
         return bn::fixed_point{
@@ -123,6 +174,10 @@ struct static_data
     bn::pool<lv_t, BN_CFG_BGS_MAX_ITEMS> levels_pool;
     bn::vector<lv_t*, BN_CFG_BGS_MAX_ITEMS> levels_vector;
 
+#if LDTK_CFG_STATS_ENABLED
+    level_bgs_stats stats;
+#endif
+
     static_data(bn::core::update_callback_type prev_callback) : previous_callback(prev_callback)
     {
     }
@@ -135,6 +190,38 @@ auto data_ref() -> static_data&
     return *std::launder(reinterpret_cast<static_data*>(data_buffer));
 }
 
+#if LDTK_CFG_STATS_ENABLED
+// `bn::timer` ticks every 64 CPU cycles
+constexpr int CPU_CYCLES_PER_TIMER_TICK = 64;
+
+void push_frame_stats(static_data& data, int update_cycles)
+{
+    frame_stats frame;
+    frame.update_cycles = update_cycles;
+
+    for (auto* level : data.levels_vector)
+    {
+        for (auto* bg : level->bgs)
+        {
+            frame.layers.push_back(
+                layer_frame_stats{bg->layer_instance.identifier(), bg->stats_cells, bg->stats_reload});
+            frame.cells += bg->stats_cells;
+            frame.reloads += bool(bg->stats_reload);
+
+            // `reload_cells_ref()` commits the whole canvas
+            if (bg->stats_committed)
+                frame.vram_bytes += int(sizeof(bg->cells));
+
+            bg->stats_cells = 0;
+            bg->stats_reload.reset();
+            bg->stats_committed = false;
+        }
+    }
+
+    data.stats.push_frame(frame);
+}
+#endif
+
 void update_callback()
 {
     if (auto previous_callback = data_ref().previous_callback)
@@ -142,6 +229,10 @@ void update_callback()
 
     static_data& data = data_ref();
 
+#if LDTK_CFG_STATS_ENABLED
+    const bn::timer timer;
+#endif
+
     for (auto* level : data.levels_vector)
     {
         const bn::fixed_point next_cam_applied_pos =
@@ -154,6 +245,21 @@ void update_callback()
 
         level->prev_cam_applied_pos = next_cam_applied_pos;
     }
+
+#if LDTK_CFG_STATS_ENABLED
+    push_frame_stats(data, timer.elapsed_ticks() * CPU_CYCLES_PER_TIMER_TICK);
+#endif
+}
+
+auto layer_tileset_bg_item(const layer& layer_) -> const bn::regular_bg_item&
+{
+    BN_BASIC_ASSERT(layer_.tileset_def());
+
+#if LDTK_GEN_LEVEL_TILESETS
+    if (const tileset_subset* subset = layer_.tileset_subset())
+        return subset->bg_item();
+#endif
+    return layer_.tileset_def()->bg_item();
 }
 
 bg_t::bg_t(const level& lv_, const layer& layer_, const bn::fixed_point& cam_applied_pos,
@@ -161,7 +267,13 @@ bg_t::bg_t(const level& lv_, const layer& layer_, const bn::fixed_point& cam_app
     : lv(lv_), layer_instance(layer_),
       grid(layer_.auto_layer_tiles() ? *layer_.auto_layer_tiles() : *layer_.grid_tiles()), grid_bloated(grid.bloated()),
       next_visible(builder.visible(layer_.identifier())), force_reload(false),
-      oob_tile(builder.out_of_bound_tile_info(layer_.identifier())), map_item(cells[0], bn::size(COLUMNS, ROWS)),
+      oob_tile(builder.out_of_bound_tile_info(layer_.identifier())),
+      tileset_bg_item(layer_tileset_bg_item(layer_)),
+      tileset_cells(tileset_bg_item.map_item().cells_ptr()),
+#if LDTK_GEN_LEVEL_TILESETS
+      tile_remap(layer_.tileset_subset() ? layer_.tileset_subset()->tile_remap().data() : nullptr),
+#endif
+      map_item(cells[0], bn::size(COLUMNS, ROWS)),
       bg_ptr(init_bg_ptr(layer_, cam_applied_pos, builder)), map_ptr(bg_ptr.map())
 {
 }
@@ -172,7 +284,8 @@ void bg_t::update(const bn::fixed_point& next_cam_applied_pos, const bn::fixed_p
     {
         if (force_reload || !bg_ptr.visible())
         {
-            update_all_cells(next_cam_applied_pos);
+            update_all_cells(next_cam_applied_pos,
+                             force_reload ? reload_reason::FORCE_RELOAD : reload_reason::VISIBILITY);
             force_reload = false;
         }
         // Update cells when level position changed
@@ -199,20 +312,24 @@ void bg_t::update_camera_applied_position(const bn::fixed_point& cam_applied_pos
     bg_ptr.set_position(apply_layer_diff(cam_applied_pos) - half_level_size + HALF_CANVAS_SIZE);
 }
 
-void bg_t::update_all_cells(const bn::fixed_point& cam_applied_pos)
+void bg_t::update_all_cells(const bn::fixed_point& cam_applied_pos, reload_reason reason)
 {
-    reset_all_cells(apply_layer_diff(cam_applied_pos));
+    reset_all_cells(apply_layer_diff(cam_applied_pos), reason);
     map_ptr.reload_cells_ref();
+    count_stats_commit();
 }
 
 void bg_t::update_part_cells(const bn::fixed_point& next_cam_applied_pos, const bn::fixed_point& prev_cam_applied_pos)
 {
     reset_part_cells(apply_layer_diff(next_cam_applied_pos), apply_layer_diff(prev_cam_applied_pos));
     map_ptr.reload_cells_ref();
+    count_stats_commit();
 }
 
-void bg_t::reset_all_cells(const bn::fixed_point& final_pos)
+void bg_t::reset_all_cells(const bn::fixed_point& final_pos, reload_reason reason)
 {
+    count_stats_reload(reason);
+
     // Everything is top-left coordinate, (0, 0) being top-left of the level
     static constexpr bn::point SCREEN_CELLS(bn::display::width() / 8, bn::display::height() / 8);
     static constexpr bn::fixed_point HALF_SCREEN_SIZE(bn::display::width() / 2, bn::display::height() / 2);
@@ -255,7 +372,7 @@ void bg_t::reset_part_cells(const bn::fixed_point& next_final_pos, const bn::fix
     // I'm doing a cheap fix to just full reload for that case.
     if (bn::abs(up_diff) >= SCREEN_CELLS.y() || bn::abs(left_diff) >= SCREEN_CELLS.x())
     {
-        reset_all_cells(next_final_pos);
+        reset_all_cells(next_final_pos, reload_reason::BIG_JUMP);
     }
     else
     {
@@ -280,6 +397,8 @@ void bg_t::reset_part_cells(const bn::fixed_point& next_final_pos, const bn::fix
 void bg_t::reset_rows(const int level_8x8_first_y, const int level_8x8_last_y, const int level_8x8_first_x,
                       const int level_8x8_last_x)
 {
+    count_stats_cells((level_8x8_last_y - level_8x8_first_y + 1) * (level_8x8_last_x - level_8x8_first_x + 1));
+
     const int m_tile_cnt = layer_instance.grid_size() >> 3;
     const int m_tile_cnt_squared = m_tile_cnt * m_tile_cnt;
 
@@ -320,11 +439,9 @@ void bg_t::reset_rows(const int level_8x8_first_y, const int level_8x8_last_y, c
 
             const int tx = m_tile_info.x_flip ? m_tile_cnt - 1 - mx_rnd_cnt : mx_rnd_cnt;
             const int ty = m_tile_info.y_flip ? m_tile_cnt - 1 - my_rnd_cnt : my_rnd_cnt;
+            const int tile_idx = remap_tile_index(m_tile_info.index);
             const bn::regular_bg_map_cell raw_cell =
-                layer_instance.tileset_def()
-                    ->bg_item()
-                    .map_item()
-                    .cells_ptr()[(m_tile_info.index * m_tile_cnt_squared) + (ty * m_tile_cnt) + tx];
+                tileset_cells[(tile_idx * m_tile_cnt_squared) + (ty * m_tile_cnt) + tx];
 
             bn::regular_bg_map_cell_info cell_info(raw_cell);
             if (m_tile_info.x_flip)
@@ -360,6 +477,8 @@ void bg_t::reset_rows(const int level_8x8_first_y, const int level_8x8_last_y, c
 void bg_t::reset_columns(const int level_8x8_first_y, const int level_8x8_last_y, const int level_8x8_first_x,
                          const int level_8x8_last_x)
 {
+    count_stats_cells((level_8x8_last_y - level_8x8_first_y + 1) * (level_8x8_last_x - level_8x8_first_x + 1));
+
     const int m_tile_cnt = layer_instance.grid_size() >> 3;
     const int m_tile_cnt_squared = m_tile_cnt * m_tile_cnt;
 
@@ -400,11 +519,9 @@ void bg_t::reset_columns(const int level_8x8_first_y, const int level_8x8_last_y
 
             const int tx = m_tile_info.x_flip ? m_tile_cnt - 1 - mx_rnd_cnt : mx_rnd_cnt;
             const int ty = m_tile_info.y_flip ? m_tile_cnt - 1 - my_rnd_cnt : my_rnd_cnt;
+            const int tile_idx = remap_tile_index(m_tile_info.index);
             const bn::regular_bg_map_cell raw_cell =
-                layer_instance.tileset_def()
-                    ->bg_item()
-                    .map_item()
-                    .cells_ptr()[(m_tile_info.index * m_tile_cnt_squared) + (ty * m_tile_cnt) + tx];
+                tileset_cells[(tile_idx * m_tile_cnt_squared) + (ty * m_tile_cnt) + tx];
 
             bn::regular_bg_map_cell_info cell_info(raw_cell);
             if (m_tile_info.x_flip)
@@ -440,15 +557,14 @@ void bg_t::reset_columns(const int level_8x8_first_y, const int level_8x8_last_y
 auto bg_t::init_bg_ptr(const layer& layer_, const bn::fixed_point& cam_applied_pos, const level_bgs_builder& lv_builder)
     -> bn::regular_bg_ptr
 {
-    BN_BASIC_ASSERT(layer_.tileset_def());
-
     const bn::fixed_point final_pos = apply_layer_diff(cam_applied_pos);
 
     // Initialize the cells first, before creating bg
-    reset_all_cells(final_pos);
+    reset_all_cells(final_pos, reload_reason::SET_LEVEL);
+    // The map of the created bg is committed as a whole
+    count_stats_commit();
 
-    bn::regular_bg_item bg_item(layer_.tileset_def()->bg_item().tiles_item(),
-                                layer_.tileset_def()->bg_item().palette_item(), map_item);
+    bn::regular_bg_item bg_item(tileset_bg_item.tiles_item(), tileset_bg_item.palette_item(), map_item);
     bn::regular_bg_builder builder(bg_item);
 
     // Apply initial bg settings
@@ -574,6 +690,34 @@ void init()
     bn::core::set_update_callback(update_callback);
 }
 
+auto memory_usage() -> ldtk::memory_usage
+{
+    const static_data& data = data_ref();
+
+    ldtk::memory_usage result;
+    result.bgs_count = data.bgs_pool.size();
+    result.max_bgs_count = data.bgs_pool.max_size();
+    result.levels_count = data.levels_pool.size();
+    result.max_levels_count = data.levels_pool.max_size();
+    result.bg_bytes = int(sizeof(bg_t));
+    result.cells_bytes = int(sizeof(bg_t::cells));
+    result.level_bytes = int(sizeof(lv_t));
+    result.total_bytes = int(sizeof(data_buffer));
+    return result;
+}
+
+#if LDTK_CFG_STATS_ENABLED
+auto stats() -> const level_bgs_stats&
+{
+    return data_ref().stats;
+}
+
+void reset_stats()
+{
+    data_ref().stats = level_bgs_stats();
+}
+#endif
+
 auto create(level_bgs_builder&& builder) -> id_t
 {
     static_data& data = data_ref();
@@ -687,7 +831,7 @@ void set_palette(id_t id, const bn::bg_palette_item& palette_item, gen::layer_id
     lv->get_bg(layer_identifier).bg_ptr.set_palette(palette_item);
 }
 
-auto dimensions(id_t id) -> const bn::size&
+auto dimensions(id_t id) -> bn::size
 {
     auto lv = static_cast<const lv_t*>(id);
     return lv->lv->px_size();
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "ldtk_gen_idents_fwd.h"
+#include "ldtk_level_bgs_stats.h"
+#include "ldtk_memory_usage.h"
 #include "ldtk_tile_grid_base.h"
 
 #include <bn_fixed.h>
@@ -38,6 +40,14 @@ using id_t = void*;
 
 void init();
 
+[[nodiscard]] auto memory_usage() -> ldtk::memory_usage;
+
+#if LDTK_CFG_STATS_ENABLED
+[[nodiscard]] auto stats() -> const level_bgs_stats&;
+
+void reset_stats();
+#endif
+
 [[nodiscard]] auto create(level_bgs_builder&& builder) -> id_t;
 
 [[nodiscard]] auto create_optional(level_bgs_builder&& builder) -> id_t;
@@ -66,7 +76,7 @@ void set_palette(id_t id, const bn::bg_palette_item& palette_item);
 
 void set_palette(id_t id, const bn::bg_palette_item& palette_item, gen::layer_ident layer_identifier);
 
-[[nodiscard]] auto dimensions(id_t id) -> const bn::size&;
+[[nodiscard]] auto dimensions(id_t id) -> bn::size;
 
 [[nodiscard]] auto position(id_t id) -> const bn::fixed_point&;
 
@@ -0,0 +1,408 @@
+#!/usr/bin/env python
+
+# SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+# SPDX-License-Identifier: Zlib
+
+"""
+Measures the compile time & peak compiler memory of each generated header,
+by compiling the translation units of `examples/tests/src/inc_test/` (one generated header each)
+against the output of `butano_ldtk.py` for a small, a medium and a huge project.
+
+   * small: `examples/tests`
+   * medium: `examples/typical_2d_platformer`
+   * huge: the `scaling` preset of `synthetic_ldtk.py`, with the parameters below
+
+Each TU is compiled with `-ftime-report` (GCC) or `-ftime-trace` (Clang), to find its most expensive phase
+(e.g. constant expression evaluation, template instantiation, parsing).
+
+Every TU also pays for the runtime headers & the shim, which dominate the small headers,
+so the headers are ranked & compared with the baseline by what they add over a TU without any generated header.
+The compile is against the host shim (`host/shim/`) with `g++` by default.
+
+Usage: python bench_compile_time.py [small medium huge] [--repeat 3] [--output compile_times.json]
+                                    [--baseline old.json] [--tolerance 10]
+                                    [--levels 16] [--level-size 1024 512] [--layers 3] [--tile-density 100]
+                                    [--entities 64] [--fields 8] [--cxx g++] [--cxx-flags "-std=c++23 -O2"]
+"""
+
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent.parent))
+
+import butano_ldtk
+from synthetic_ldtk import ScalingParams, write_scaling_project
+from typing import Dict, List, NamedTuple, Optional, Tuple
+import argparse
+import contextlib
+import io
+import json
+import os
+import re
+import shlex
+import subprocess
+import tempfile
+import time
+
+REPO_PATH = Path(__file__).resolve().parent.parent.parent
+INC_TEST_PATH = REPO_PATH / "examples" / "tests" / "src" / "inc_test"
+INC_TEST_SUFFIX = "_inc_test.cpp"
+
+# Same options as the host build (`host/CMakeLists.txt`), so that every header of `inc_test/` is generated
+PROJECT_OPTIONS = {
+    "small": dict(entity_tables=True, entity_tag_index=True, direct_bg_items=True),
+    "medium": dict(level_tilesets=True, direct_bg_items=True),
+    "huge": dict(entity_tables=True, entity_tag_index=True, direct_bg_items=True),
+}
+PROJECT_PATHS = {
+    "small": REPO_PATH / "examples" / "tests" / "levels" / "test.ldtk",
+    "medium": REPO_PATH
+    / "examples"
+    / "typical_2d_platformer"
+    / "levels"
+    / "typical_2d_platformer.ldtk",
+}
+
+HUGE_PARAMS = ScalingParams(
+    levels=16,
+    level_px_width=1024,
+    level_px_height=512,
+    layers=3,
+    tile_percent=100,
+    entities=64,
+    fields=8,
+)
+
+# Same as the host build (`host/CMakeLists.txt`)
+DEFAULT_CXX_FLAGS = "-std=c++23 -O2"
+
+# Runtime headers & shim only, which every generated header pays for
+EMPTY_TU_NAME = "(no generated header)"
+EMPTY_TU_SOURCE = '#include "ldtk_core.h"\n'
+
+# Changes smaller than this are noise, whatever `--tolerance` is;
+# Applied to what a header adds over `EMPTY_TU_NAME`, which is the difference of two noisy compiles
+NOISE_FLOOR_SECONDS = 0.05
+NOISE_FLOOR_BYTES = 4 * 1024 * 1024
+
+# ` template instantiation               :   0.01 ( 10%)   0.00 (  0%)   0.02 ( 12%)   579k ( 26%)`
+GCC_TIME_REPORT_LINE = re.compile(
+    r"^ (?P<phase>\S.*?)\s+:\s+[\d.]+ \(\s*\d+%\)\s+[\d.]+ \(\s*\d+%\)\s+(?P<wall>[\d.]+) "
+)
+
+# Clang trace events that sum up others, or the whole compile
+CLANG_TOTAL_EVENTS = {"Total ExecuteCompiler", "Total Frontend", "Total Backend"}
+
+
+class Measurement(NamedTuple):
+    seconds: float
+    peak_bytes: Optional[int]
+    phase: Optional[str]
+    phase_seconds: float
+
+
+def is_clang(cxx: str) -> bool:
+    result = subprocess.run(
+        [*shlex.split(cxx), "--version"], capture_output=True, text=True
+    )
+    return "clang" in result.stdout.lower()
+
+
+def convert_project(name: str, temp_path: Path, huge_params: ScalingParams) -> Path:
+    """Converts the project with `butano_ldtk.py`, and returns its build folder"""
+    if name == "huge":
+        project_path = write_scaling_project(temp_path / "huge_project", 0, huge_params)
+    else:
+        project_path = PROJECT_PATHS[name]
+
+    build_path = temp_path / f"{name}_build"
+    # Keep the progress messages of `butano_ldtk.py` out of the table
+    with contextlib.redirect_stdout(io.StringIO()):
+        butano_ldtk.process_ldtk(project_path, build_path, **PROJECT_OPTIONS[name])
+    return build_path
+
+
+def gcc_dominant_phase(time_report: str) -> Tuple[Optional[str], float]:
+    """Most expensive item of `-ftime-report`, other than the `phase ...` sums & the `TOTAL`"""
+    phase, phase_seconds = None, 0.0
+    for line in time_report.splitlines():
+        match = GCC_TIME_REPORT_LINE.match(line)
+        if match is None:
+            continue
+        # Sub-items of the previous item are prefixed by `|`
+        name = match["phase"].strip().lstrip("|")
+        if name.startswith("phase ") or name == "TOTAL":
+            continue
+        if float(match["wall"]) > phase_seconds:
+            phase, phase_seconds = name, float(match["wall"])
+    return phase, phase_seconds
+
+
+def clang_dominant_phase(trace_path: Path) -> Tuple[Optional[str], float]:
+    """Most expensive `Total ...` event of `-ftime-trace`, other than the sums of the whole compile"""
+    phase, phase_seconds = None, 0.0
+    if not trace_path.is_file():
+        return phase, phase_seconds
+    for event in json.loads(trace_path.read_text()).get("traceEvents", []):
+        name = event.get("name", "")
+        if not name.startswith("Total ") or name in CLANG_TOTAL_EVENTS:
+            continue
+        seconds = event.get("dur", 0) / 1_000_000
+        if seconds > phase_seconds:
+            phase, phase_seconds = name.removeprefix("Total "), seconds
+    return phase, phase_seconds
+
+
+def run_compile(command: List[str], stderr_path: Path) -> Tuple[int, Optional[int]]:
+    """Returns the exit code & the peak RSS of the compiler, including the processes it spawned (e.g. `cc1plus`)"""
+    with stderr_path.open("w") as stderr_file:
+        process = subprocess.Popen(
+            command, stdout=subprocess.DEVNULL, stderr=stderr_file
+        )
+        if not hasattr(os, "wait4"):  # Windows
+            return process.wait(), None
+
+        _, status, usage = os.wait4(process.pid, 0)
+        process.returncode = os.waitstatus_to_exitcode(status)
+
+    # Kilobytes on Linux, bytes on macOS
+    max_rss = usage.ru_maxrss if sys.platform == "darwin" else usage.ru_maxrss * 1024
+    return process.returncode, max_rss
+
+
+def compile_source(
+    source_path: Path, build_path: Path, cxx: str, cxx_flags: str, clang: bool
+) -> Measurement:
+    shim_path = REPO_PATH / "host" / "shim" / "include"
+    object_path = build_path / "obj" / (source_path.stem + ".o")
+    object_path.parent.mkdir(parents=True, exist_ok=True)
+    command = [
+        *shlex.split(cxx),
+        *shlex.split(cxx_flags),
+        "-ftime-trace" if clang else "-ftime-report",
+        "-include",
+        str(shim_path / "bn_host_compat.h"),
+        "-I",
+        str(REPO_PATH / "include"),
+        "-I",
+        str(REPO_PATH / "src"),
+        "-I",
+        str(shim_path),
+        "-I",
+        str(build_path / "include"),
+        "-c",
+        str(source_path),
+        "-o",
+        str(object_path),
+    ]
+
+    stderr_path = object_path.with_suffix(".stderr")
+    begin = time.perf_counter()
+    returncode, peak_bytes = run_compile(command, stderr_path)
+    seconds = time.perf_counter() - begin
+    if returncode != 0:
+        sys.exit(
+            f"Error: Compile failed\n{shlex.join(command)}\n{stderr_path.read_text()}"
+        )
+
+    if clang:
+        phase, phase_seconds = clang_dominant_phase(object_path.with_suffix(".json"))
+    else:
+        phase, phase_seconds = gcc_dominant_phase(stderr_path.read_text())
+    return Measurement(seconds, peak_bytes, phase, phase_seconds)
+
+
+def inc_test_sources(build_path: Path) -> Dict[str, Path]:
+    """Generated header name -> its `inc_test/` TU, for the headers generated with the options of the project"""
+    sources: Dict[str, Path] = {}
+    for source_path in sorted(INC_TEST_PATH.glob("*" + INC_TEST_SUFFIX)):
+        header_name = source_path.name.removesuffix(INC_TEST_SUFFIX) + ".h"
+        if build_path.joinpath("include", header_name).is_file():
+            sources[header_name] = source_path
+    return sources
+
+
+def measure_project(
+    build_path: Path, repeat: int, cxx: str, cxx_flags: str, clang: bool
+) -> Dict[str, Measurement]:
+    empty_source_path = build_path / "bench_compile_time_empty.cpp"
+    empty_source_path.write_text(EMPTY_TU_SOURCE)
+    sources = {EMPTY_TU_NAME: empty_source_path, **inc_test_sources(build_path)}
+
+    results: Dict[str, Measurement] = {}
+    for header_name, source_path in sources.items():
+        best: Optional[Measurement] = None
+        for _ in range(repeat):
+            measurement = compile_source(source_path, build_path, cxx, cxx_flags, clang)
+            if best is None or measurement.seconds < best.seconds:
+                best = measurement
+        assert best is not None
+        results[header_name] = best
+    return results
+
+
+def added_cost(headers: dict, header_name: str, key: str) -> Optional[float]:
+    """
+    `key` (`"seconds"` or `"peak_bytes"`) of the header over the TU without any generated header,
+    or the absolute one of that TU itself.
+
+    Clamped to `0`, as the headers cheaper than the empty TU are within the noise.
+    """
+    value = headers[header_name].get(key)
+    if header_name == EMPTY_TU_NAME or value is None:
+        return value
+    empty_value = headers.get(EMPTY_TU_NAME, {}).get(key)
+    if empty_value is None:
+        return None
+    return max(0, value - empty_value)
+
+
+def print_table(project: str, results: Dict[str, Measurement], repeat: int):
+    """The `EMPTY_TU_NAME` row comes first with its absolute cost, and the others with what they add over it"""
+    headers = {name: m._asdict() for name, m in results.items()}
+    seconds = {name: added_cost(headers, name, "seconds") for name in headers}
+    peak_bytes = {name: added_cost(headers, name, "peak_bytes") for name in headers}
+
+    total = sum(s for name, s in seconds.items() if name != EMPTY_TU_NAME)
+    print(
+        f"## {project}: {total:.2f} s in total over {EMPTY_TU_NAME}, best of {repeat}"
+    )
+    print()
+    print(
+        f"{EMPTY_TU_NAME} is the absolute cost of the runtime headers & the shim, which every header pays for."
+    )
+    print()
+    print("| header | added seconds | added peak memory (MiB) | dominant phase |")
+    print("|---|---:|---:|---|")
+    for header_name, m in sorted(
+        results.items(),
+        key=lambda item: (item[0] != EMPTY_TU_NAME, -(seconds[item[0]] or 0)),
+    ):
+        peak = peak_bytes[header_name]
+        peak = "-" if peak is None else f"{peak / (1024 * 1024):.0f}"
+        phase = "-" if m.phase is None else f"{m.phase} ({m.phase_seconds:.2f} s)"
+        print(f"| {header_name} | {seconds[header_name]:.2f} | {peak} | {phase} |")
+    print(flush=True)
+
+
+def find_regressions(results: dict, baseline: dict, tolerance: float) -> List[str]:
+    """Compares what each header adds over `EMPTY_TU_NAME`, and the absolute cost of `EMPTY_TU_NAME` itself"""
+    regressions: List[str] = []
+    ratio = 1 + tolerance / 100
+
+    for project, headers in results.items():
+        baseline_headers = baseline.get(project, {})
+        for header_name in headers:
+            if header_name not in baseline_headers:
+                continue
+            over = "" if header_name == EMPTY_TU_NAME else f" over {EMPTY_TU_NAME}"
+
+            old = added_cost(baseline_headers, header_name, "seconds")
+            new = added_cost(headers, header_name, "seconds")
+            if (
+                old is not None
+                and new is not None
+                and new > old * ratio
+                and new - old > NOISE_FLOOR_SECONDS
+            ):
+                regressions.append(
+                    f"{project}/{header_name} seconds{over}: {old:.2f} -> {new:.2f}"
+                )
+
+            old = added_cost(baseline_headers, header_name, "peak_bytes")
+            new = added_cost(headers, header_name, "peak_bytes")
+            if (
+                old is not None
+                and new is not None
+                and new > old * ratio
+                and new - old > NOISE_FLOOR_BYTES
+            ):
+                regressions.append(
+                    f"{project}/{header_name} peak memory{over}: {old // 1024} KiB -> {new // 1024} KiB"
+                )
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Benchmark the compile time & memory of each header generated by butano_ldtk.py"
+    )
+    parser.add_argument(
+        "projects",
+        nargs="*",
+        choices=["small", "medium", "huge"],
+        default=["small", "medium", "huge"],
+        help="projects to convert & compile (default: all)",
+    )
+    parser.add_argument(
+        "--repeat", type=int, default=3, help="Best of N compiles is reported"
+    )
+    parser.add_argument("--levels", type=int, default=HUGE_PARAMS.levels)
+    parser.add_argument(
+        "--level-size",
+        type=int,
+        nargs=2,
+        metavar=("WIDTH", "HEIGHT"),
+        default=(HUGE_PARAMS.level_px_width, HUGE_PARAMS.level_px_height),
+    )
+    parser.add_argument("--layers", type=int, default=HUGE_PARAMS.layers)
+    parser.add_argument("--tile-density", type=int, default=HUGE_PARAMS.tile_percent)
+    parser.add_argument("--entities", type=int, default=HUGE_PARAMS.entities)
+    parser.add_argument("--fields", type=int, default=HUGE_PARAMS.fields)
+    parser.add_argument("--cxx", default="g++", help="C++ compiler")
+    parser.add_argument(
+        "--cxx-flags", default=DEFAULT_CXX_FLAGS, help="C++ compiler flags"
+    )
+    parser.add_argument("--output", type=Path, help="JSON output path")
+    parser.add_argument(
+        "--baseline", type=Path, help="previous JSON output to compare with"
+    )
+    parser.add_argument(
+        "--tolerance",
+        type=float,
+        default=10.0,
+        help="allowed increase of the compile time & peak memory that a header adds, in percent (default: %(default)s)",
+    )
+    args = parser.parse_args()
+
+    huge_params = ScalingParams(
+        args.levels,
+        args.level_size[0],
+        args.level_size[1],
+        args.layers,
+        args.tile_density,
+        args.entities,
+        args.fields,
+    )
+    clang = is_clang(args.cxx)
+    results: dict = {}
+
+    with tempfile.TemporaryDirectory(prefix="bench_compile_time_") as temp:
+        for project in dict.fromkeys(args.projects):
+            build_path = convert_project(project, Path(temp), huge_params)
+            measurements = measure_project(
+                build_path, args.repeat, args.cxx, args.cxx_flags, clang
+            )
+            if project == "huge":
+                print(f"huge: {huge_params}")
+            print_table(project, measurements, args.repeat)
+            results[project] = {
+                header_name: m._asdict() for header_name, m in measurements.items()
+            }
+
+    if args.output:
+        args.output.write_text(json.dumps(results, indent=2, sort_keys=True) + "\n")
+
+    if args.baseline:
+        regressions = find_regressions(
+            results, json.loads(args.baseline.read_text()), args.tolerance
+        )
+        for regression in regressions:
+            print(f"Regression: {regression}", file=sys.stderr)
+        if regressions:
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
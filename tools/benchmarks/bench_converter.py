@@ -0,0 +1,292 @@
+#!/usr/bin/env python
+
+# SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+# SPDX-License-Identifier: Zlib
+
+"""
+Measures how `process_ldtk()` of `butano_ldtk.py` and the C++ compile of its generated headers scale,
+on the `scaling` preset of `synthetic_ldtk.py` with a parameter swept.
+
+Each row is the best of `--repeat` runs of each stage on a fresh build folder:
+load, validate, tileset infos, image generation, header generation, then the compile.
+The compile is against the host shim (`host/shim/`) with `g++` by default.
+
+Usage: python bench_converter.py [--sweep levels] [--values 1 4 16 64] [--repeat 3] [--jobs N]
+                                 [--levels 4] [--level-size 512 256] [--layers 2] [--tile-density 100]
+                                 [--entities 16] [--fields 4] [--cxx g++] [--no-compile]
+"""
+
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent.parent))
+
+import butano_ldtk
+from synthetic_ldtk import ScalingParams, write_scaling_project
+from typing import Callable, Dict, NamedTuple, Optional
+import argparse
+import contextlib
+import io
+import math
+import os
+import shlex
+import subprocess
+import tempfile
+import time
+
+REPO_PATH = Path(__file__).resolve().parent.parent.parent
+
+STAGES = ["load", "validate", "tileset infos", "images", "headers"]
+
+# `--sweep` name -> `ScalingParams` field
+SWEEPS = {
+    "levels": "levels",
+    "level-width": "level_px_width",
+    "level-height": "level_px_height",
+    "layers": "layers",
+    "tile-density": "tile_percent",
+    "entities": "entities",
+    "fields": "fields",
+}
+
+DEFAULT_SWEEP_VALUES = {
+    "levels": [1, 4, 16, 64],
+    "level-width": [256, 512, 1024, 2048],
+    "level-height": [256, 512, 1024, 2048],
+    "layers": [1, 2, 3, 4],
+    "tile-density": [0, 25, 50, 100],
+    "entities": [0, 16, 64, 256],
+    "fields": [0, 4, 16, 64],
+}
+
+# Same as the host build (`host/CMakeLists.txt`), which the generated headers are checked against
+DEFAULT_CXX_FLAGS = "-std=c++23 -O2"
+
+# Needs `gen_project` to be constant evaluated, as the games do
+COMPILE_SOURCE = """#include "ldtk_gen_project.h"
+
+static_assert(ldtk::gen::gen_project.levels().size() > 0);
+"""
+
+
+class Measurement(NamedTuple):
+    stages: Dict[str, float]
+    compile: Optional[float]
+    headers_bytes: int
+
+    @property
+    def total(self) -> float:
+        return sum(self.stages.values()) + (self.compile or 0)
+
+
+def process_ldtk_stages(
+    project_path: Path, build_path: Path, jobs: int
+) -> Dict[str, float]:
+    """Same as `process_ldtk()` with `--direct-bg-items`, but times each stage"""
+    for folder in ("include", "graphics", "src"):
+        butano_ldtk.create_folder(build_path.joinpath(folder))
+    butano_ldtk.generated_file_paths.clear()
+
+    times: Dict[str, float] = {}
+
+    def timed(stage: str, func: Callable[[], object]):
+        begin = time.perf_counter()
+        result = func()
+        times[stage] = times.get(stage, 0) + time.perf_counter() - begin
+        return result
+
+    project = timed("load", lambda: butano_ldtk.load_ldtk_project(project_path, jobs))
+    timed("validate", lambda: butano_ldtk.purge_ignore_tilesets(project, None))
+    timed("validate", lambda: butano_ldtk.ensure_no_unsupported_features(project))
+    enum_infos = timed("tileset infos", lambda: butano_ldtk.EnumInfos(project))
+    tileset_infos = timed("tileset infos", lambda: butano_ldtk.TilesetInfos(project))
+    timed(
+        "images",
+        lambda: butano_ldtk.generate_tilesets_bg_items(
+            tileset_infos,
+            project,
+            project_path.parent,
+            build_path,
+            False,
+            False,
+            True,
+            jobs,
+        ),
+    )
+
+    def generate_headers():
+        array_interner = butano_ldtk.ArrayInterner()
+        butano_ldtk.generate_definitions_headers(
+            enum_infos, tileset_infos, project, build_path, array_interner
+        )
+        butano_ldtk.generate_levels_headers(
+            tileset_infos,
+            project,
+            project_path.parent,
+            build_path,
+            False,
+            False,
+            False,
+            False,
+            False,
+            False,
+            array_interner,
+            jobs,
+        )
+        butano_ldtk.generate_enum_headers(project, build_path, False)
+        butano_ldtk.ProjectHeader(project).write(build_path)
+
+    timed("headers", generate_headers)
+    return times
+
+
+def compile_headers(build_path: Path, cxx: str, cxx_flags: str) -> float:
+    source_path = build_path.joinpath("bench_converter.cpp")
+    source_path.write_text(COMPILE_SOURCE)
+
+    shim_path = REPO_PATH.joinpath("host", "shim", "include")
+    command = [
+        *shlex.split(cxx),
+        *shlex.split(cxx_flags),
+        "-include",
+        str(shim_path.joinpath("bn_host_compat.h")),
+        "-I",
+        str(REPO_PATH.joinpath("include")),
+        "-I",
+        str(REPO_PATH.joinpath("src")),
+        "-I",
+        str(shim_path),
+        "-I",
+        str(build_path.joinpath("include")),
+        "-c",
+        str(source_path),
+        "-o",
+        os.devnull,
+    ]
+
+    begin = time.perf_counter()
+    result = subprocess.run(command, capture_output=True, text=True)
+    elapsed = time.perf_counter() - begin
+    if result.returncode != 0:
+        sys.exit(f"Error: Compile failed\n{shlex.join(command)}\n{result.stderr}")
+    return elapsed
+
+
+def measure(
+    params: ScalingParams,
+    seed: int,
+    repeat: int,
+    jobs: int,
+    cxx: Optional[str],
+    cxx_flags: str,
+) -> Measurement:
+    stages = {stage: math.inf for stage in STAGES}
+    compile_time = math.inf if cxx else None
+    headers_bytes = 0
+
+    with tempfile.TemporaryDirectory(prefix="bench_converter_") as temp:
+        project_path = write_scaling_project(Path(temp, "project"), seed, params)
+
+        for run in range(repeat):
+            build_path = Path(temp, f"build_{run}")
+            # Keep the progress messages of `butano_ldtk.py` out of the table
+            with contextlib.redirect_stdout(io.StringIO()):
+                times = process_ldtk_stages(project_path, build_path, jobs)
+            for stage, elapsed in times.items():
+                stages[stage] = min(stages[stage], elapsed)
+
+            if cxx:
+                compile_time = min(
+                    compile_time, compile_headers(build_path, cxx, cxx_flags)
+                )
+
+        headers_bytes = sum(
+            path.stat().st_size for path in build_path.joinpath("include").iterdir()
+        )
+
+    return Measurement(stages, compile_time, headers_bytes)
+
+
+def main():
+    defaults = ScalingParams()
+
+    parser = argparse.ArgumentParser(
+        description="Benchmark how butano_ldtk.py scales on synthetic LDtk projects"
+    )
+    parser.add_argument(
+        "--sweep",
+        choices=list(SWEEPS),
+        default="levels",
+        help="Parameter to sweep",
+    )
+    parser.add_argument(
+        "--values",
+        type=int,
+        nargs="+",
+        help="Values of the swept parameter (default depends on --sweep)",
+    )
+    parser.add_argument("--levels", type=int, default=defaults.levels)
+    parser.add_argument(
+        "--level-size",
+        type=int,
+        nargs=2,
+        metavar=("WIDTH", "HEIGHT"),
+        default=(defaults.level_px_width, defaults.level_px_height),
+    )
+    parser.add_argument("--layers", type=int, default=defaults.layers)
+    parser.add_argument("--tile-density", type=int, default=defaults.tile_percent)
+    parser.add_argument("--entities", type=int, default=defaults.entities)
+    parser.add_argument("--fields", type=int, default=defaults.fields)
+    parser.add_argument("--seed", type=int, default=0, help="Random seed")
+    parser.add_argument(
+        "--repeat", type=int, default=3, help="Best of N runs is reported"
+    )
+    parser.add_argument(
+        "--jobs",
+        type=int,
+        default=butano_ldtk.default_jobs(),
+        help="Worker processes of butano_ldtk.py",
+    )
+    parser.add_argument("--cxx", default="g++", help="C++ compiler")
+    parser.add_argument(
+        "--cxx-flags", default=DEFAULT_CXX_FLAGS, help="C++ compiler flags"
+    )
+    parser.add_argument(
+        "--no-compile", action="store_true", help="Skip the C++ compile"
+    )
+    args = parser.parse_args()
+
+    base = ScalingParams(
+        args.levels,
+        args.level_size[0],
+        args.level_size[1],
+        args.layers,
+        args.tile_density,
+        args.entities,
+        args.fields,
+    )
+    values = args.values or DEFAULT_SWEEP_VALUES[args.sweep]
+    cxx = None if args.no_compile else args.cxx
+
+    columns = [args.sweep, *STAGES]
+    if cxx:
+        columns.append("compile")
+    columns += ["total", "headers (KiB)"]
+    print(f"Seconds, best of {args.repeat}, with {base}")
+    print()
+    print("| " + " | ".join(columns) + " |")
+    print("|" + "|".join("---:" for _ in columns) + "|")
+
+    for value in values:
+        params = base._replace(**{SWEEPS[args.sweep]: value})
+        result = measure(params, args.seed, args.repeat, args.jobs, cxx, args.cxx_flags)
+
+        cells = [str(value)] + [f"{result.stages[stage]:.3f}" for stage in STAGES]
+        if cxx:
+            cells.append(f"{result.compile:.3f}")
+        cells += [f"{result.total:.3f}", f"{result.headers_bytes / 1024:.0f}"]
+        print("| " + " | ".join(cells) + " |", flush=True)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,154 @@
+#!/usr/bin/env python
+
+# SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+# SPDX-License-Identifier: Zlib
+
+"""
+Compares the tile extraction of `butano_ldtk.py` with the previous crop & paste per 8x8 tile,
+on big synthetic tilesets (2048x2048 by default).
+
+Usage: python bench_tileset_extraction.py [--size 2048] [--tile-sizes 8 16 32] [--repeat 3]
+"""
+
+import sys
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent.parent))
+
+from butano_ldtk import paste_used_tiles
+from models import Point
+from typing import Callable, List
+from PIL import Image
+import argparse
+import math
+import random
+import time
+
+# Same as `generate_tileset_bg_item()`
+TILESET_BG_WIDTH = 256
+TEMP_LARGE_WIDTH = TILESET_BG_WIDTH * 2 + 1
+TILESET_BG_HEIGHT_UNIT = 256
+MAX_USED_TILES_COUNT = (1 << 14) - 1
+
+
+def paste_used_tiles_per_tile(
+    tileset_bg: Image.Image,
+    tileset_src: Image.Image,
+    used_tile_srcs: List[Point],
+    tile_size: int,
+):
+    """The previous implementation, which crops & pastes each 8x8 tile"""
+    paste_x, paste_y = ((tile_size >> 3) ** 2) * 8, 0
+    while paste_x >= TILESET_BG_WIDTH:
+        paste_x -= TILESET_BG_WIDTH
+        paste_y += 8
+
+    for src in used_tile_srcs:
+        for y in range(tile_size >> 3):
+            for x in range(tile_size >> 3):
+                sub_x = src.x + x * 8
+                sub_y = src.y + y * 8
+                tile = tileset_src.crop((sub_x, sub_y, sub_x + 8, sub_y + 8))
+                tileset_bg.paste(tile, (paste_x, paste_y))
+
+                paste_x += 8
+                if paste_x >= TILESET_BG_WIDTH:
+                    paste_x = 0
+                    paste_y += 8
+
+
+def make_tileset_src(size: int, mode: str, seed: int) -> Image.Image:
+    rand = random.Random(seed)
+    if mode == "P":
+        tileset_src = Image.frombytes("P", (size, size), rand.randbytes(size * size))
+        tileset_src.putpalette(rand.randbytes(256 * 3))
+        return tileset_src
+    return Image.frombytes("RGBA", (size, size), rand.randbytes(size * size * 4))
+
+
+def make_used_tile_srcs(size: int, tile_size: int, seed: int) -> List[Point]:
+    srcs = [
+        Point(x, y)
+        for y in range(0, size - tile_size + 1, tile_size)
+        for x in range(0, size - tile_size + 1, tile_size)
+    ]
+    random.Random(seed).shuffle(srcs)
+    return srcs[:MAX_USED_TILES_COUNT]
+
+
+def make_tileset_bg(mode: str, tile_size: int, tiles_count: int) -> Image.Image:
+    tiles_count_per_height_unit = 1024 / ((tile_size >> 3) ** 2)
+    height = TILESET_BG_HEIGHT_UNIT * math.ceil(
+        (1 + tiles_count) / tiles_count_per_height_unit
+    )
+    if mode == "P":
+        return Image.new("P", (TILESET_BG_WIDTH, height))
+    return Image.new("RGBA", (TEMP_LARGE_WIDTH, height), color="#00FF0000")
+
+
+def measure(
+    paste: Callable[[Image.Image, Image.Image, List[Point], int], None],
+    mode: str,
+    tileset_src: Image.Image,
+    used_tile_srcs: List[Point],
+    tile_size: int,
+    repeat: int,
+) -> tuple[float, bytes]:
+    best = math.inf
+    result = b""
+    for _ in range(repeat):
+        tileset_bg = make_tileset_bg(mode, tile_size, len(used_tile_srcs))
+        begin = time.perf_counter()
+        paste(tileset_bg, tileset_src, used_tile_srcs, tile_size)
+        best = min(best, time.perf_counter() - begin)
+        result = tileset_bg.tobytes()
+    return best, result
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Benchmark the tile extraction of butano_ldtk.py"
+    )
+    parser.add_argument("--size", type=int, default=2048, help="Tileset image size")
+    parser.add_argument(
+        "--tile-sizes", type=int, nargs="+", default=[8, 16, 32], help="Tile sizes"
+    )
+    parser.add_argument(
+        "--repeat", type=int, default=3, help="Best of N runs is reported"
+    )
+    args = parser.parse_args()
+
+    print(
+        f"{'mode':>5} {'tile':>5} {'used':>6} {'per-tile (s)':>13} {'buffer (s)':>11} {'speedup':>8}"
+    )
+    for mode in ("RGBA", "P"):
+        tileset_src = make_tileset_src(args.size, mode, seed=args.size)
+        for tile_size in args.tile_sizes:
+            used_tile_srcs = make_used_tile_srcs(args.size, tile_size, seed=tile_size)
+
+            old_time, old_result = measure(
+                paste_used_tiles_per_tile,
+                mode,
+                tileset_src,
+                used_tile_srcs,
+                tile_size,
+                args.repeat,
+            )
+            new_time, new_result = measure(
+                paste_used_tiles,
+                mode,
+                tileset_src,
+                used_tile_srcs,
+                tile_size,
+                args.repeat,
+            )
+            if old_result != new_result:
+                sys.exit(f"Error: Results differ ({mode}, tile size {tile_size})")
+
+            print(
+                f"{mode:>5} {tile_size:>5} {len(used_tile_srcs):>6} {old_time:>13.3f} {new_time:>11.3f} {old_time / new_time:>7.1f}x"
+            )
+
+
+if __name__ == "__main__":
+    main()
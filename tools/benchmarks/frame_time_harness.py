@@ -0,0 +1,304 @@
+#!/usr/bin/env python
+
+# SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+# SPDX-License-Identifier: Zlib
+
+"""
+Runs the example ROMs in mGBA with recorded inputs, and writes their frame costs to a JSON file.
+
+The ROMs must be built with `-DBN_CFG_LOG_ENABLED=true -DCOMMON_CFG_FRAME_LOG_ENABLED=true` (or `--make`),
+so that `common::stats` logs `bn::core::last_cpu_usage()` of every frame.
+Inputs are in `frame_time_inputs/<rom>.txt`, and each of their segments (e.g. `level_switch`) gets its own stats.
+
+Usage: python frame_time_harness.py [--make] [--baseline old.json] [--output frame_times.json] [rom ...]
+"""
+
+from pathlib import Path
+from typing import Dict, List, NamedTuple
+import argparse
+import json
+import math
+import shlex
+import subprocess
+import sys
+import tempfile
+import threading
+
+EXAMPLES_PATH = Path(__file__).resolve().parent.parent.parent / "examples"
+INPUTS_PATH = Path(__file__).resolve().parent / "frame_time_inputs"
+
+DEFAULT_ROMS = ("parallax_level_bgs", "typical_2d_platformer", "stress_level_bgs")
+LOG_USERFLAGS = "-DBN_CFG_LOG_ENABLED=true -DCOMMON_CFG_FRAME_LOG_ENABLED=true"
+
+# `bn::fixed` of `bn::core::last_cpu_usage()`, where `FULL_FRAME` is 100% of a frame
+FULL_FRAME = 4096
+
+# Bits of the GBA `KEYINPUT` register, which `emu:setKeys()` takes
+KEY_BITS = {
+    "A": 0,
+    "B": 1,
+    "SELECT": 2,
+    "START": 3,
+    "RIGHT": 4,
+    "LEFT": 5,
+    "UP": 6,
+    "DOWN": 7,
+    "R": 8,
+    "L": 9,
+}
+
+FRAME_MARKER = "[frame] "
+SEGMENT_MARKER = "[segment] "
+END_MARKER = "[end]"
+
+
+class InputEvent(NamedTuple):
+    frame: int
+    segment: str
+    keys: int
+
+
+def parse_inputs(input_path: Path) -> List[InputEvent]:
+    """
+    Each line is `<frame> <segment> <keys...>`, where the keys are held until the next line. (`-` for no keys)
+    The last line is `<frame> end`, which ends the run.
+    """
+    events: List[InputEvent] = []
+
+    for line_number, line in enumerate(input_path.read_text().splitlines(), start=1):
+        line = line.split("#", 1)[0].strip()
+        if not line:
+            continue
+
+        tokens = line.split()
+        if len(tokens) < 2:
+            raise ValueError(
+                f"{input_path}:{line_number}: expected `<frame> <segment> <keys...>`"
+            )
+
+        frame, segment = int(tokens[0]), tokens[1]
+        if events and frame <= events[-1].frame:
+            raise ValueError(
+                f"{input_path}:{line_number}: frame {frame} is not increasing"
+            )
+
+        keys = 0
+        for key in tokens[2:]:
+            if key == "-":
+                continue
+            if key not in KEY_BITS:
+                raise ValueError(f"{input_path}:{line_number}: unknown key `{key}`")
+            keys |= 1 << KEY_BITS[key]
+
+        events.append(InputEvent(frame, segment, keys))
+
+    if not events or events[-1].segment != "end":
+        raise ValueError(f"{input_path}: the last line must be `<frame> end`")
+
+    return events
+
+
+def make_lua_script(events: List[InputEvent]) -> str:
+    """mGBA script which feeds the inputs, and marks the segments in the log"""
+    lines = ["local events = {"]
+    for event in events:
+        lines.append(f'    {{ {event.frame}, "{event.segment}", {event.keys} }},')
+    lines.append("}")
+    lines.append(f"""
+local index = 1
+
+callbacks:add("frame", function()
+    local frame = emu:currentFrame()
+    while index <= #events and events[index][1] <= frame do
+        local event = events[index]
+        if event[2] == "end" then
+            console:log("{END_MARKER}")
+        else
+            console:log("{SEGMENT_MARKER}" .. event[2])
+            emu:setKeys(event[3])
+        end
+        index = index + 1
+    end
+end)
+""")
+    return "\n".join(lines)
+
+
+def run_rom(
+    emulator: List[str], rom_path: Path, events: List[InputEvent], timeout: float
+) -> Dict[str, List[int]]:
+    """Returns the logged CPU usages per segment, in the order of the frames"""
+    usages: Dict[str, List[int]] = {}
+    segment = "boot"
+
+    with tempfile.TemporaryDirectory() as temp_folder:
+        script_path = Path(temp_folder) / "frame_time_harness.lua"
+        script_path.write_text(make_lua_script(events))
+
+        command = [arg.format(script=script_path, rom=rom_path) for arg in emulator]
+        process = subprocess.Popen(
+            command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True
+        )
+        # Kills a stuck emulator, which ends the reading below
+        watchdog = threading.Timer(timeout, process.kill)
+        watchdog.start()
+        reached_end = False
+
+        try:
+            assert process.stdout is not None
+            for line in process.stdout:
+                if END_MARKER in line:
+                    reached_end = True
+                    break
+                if SEGMENT_MARKER in line:
+                    segment = line.split(SEGMENT_MARKER, 1)[1].strip()
+                elif FRAME_MARKER in line:
+                    usage = int(line.split(FRAME_MARKER, 1)[1].split()[1])
+                    usages.setdefault(segment, []).append(usage)
+        finally:
+            watchdog.cancel()
+            process.kill()
+            process.wait()
+
+    if not reached_end:
+        raise TimeoutError(f"{rom_path.name} didn't reach the end frame in {timeout}s")
+    if not usages:
+        raise RuntimeError(
+            f"{rom_path.name} didn't log any frame; build it with `{LOG_USERFLAGS}`"
+        )
+
+    return usages
+
+
+def percentile(sorted_values: List[int], percent: float) -> int:
+    """Nearest-rank percentile"""
+    rank = max(math.ceil(len(sorted_values) * percent / 100), 1)
+    return sorted_values[rank - 1]
+
+
+def summarize(usages: List[int]) -> Dict[str, float]:
+    """Frame cost stats, in percent of a frame"""
+    sorted_usages = sorted(usages)
+
+    def to_percent(usage: float) -> float:
+        return round(usage * 100 / FULL_FRAME, 3)
+
+    return {
+        "frames": len(usages),
+        "mean": to_percent(sum(usages) / len(usages)),
+        "p99": to_percent(percentile(sorted_usages, 99)),
+        "max": to_percent(sorted_usages[-1]),
+    }
+
+
+def find_regressions(results: dict, baseline: dict, tolerance: float) -> List[str]:
+    regressions: List[str] = []
+
+    for rom, rom_result in results.items():
+        baseline_rom = baseline.get(rom)
+        if baseline_rom is None:
+            continue
+
+        pairs = [("total", rom_result["total"], baseline_rom.get("total"))]
+        for segment, stats in rom_result["segments"].items():
+            pairs.append(
+                (segment, stats, baseline_rom.get("segments", {}).get(segment))
+            )
+
+        for name, stats, baseline_stats in pairs:
+            if baseline_stats is None:
+                continue
+            for key in ("max", "p99"):
+                if stats[key] > baseline_stats[key] + tolerance:
+                    regressions.append(
+                        f"{rom}/{name} {key}: {baseline_stats[key]}% -> {stats[key]}%"
+                    )
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Frame cost regression harness of the example ROMs"
+    )
+    parser.add_argument(
+        "roms",
+        nargs="*",
+        default=list(DEFAULT_ROMS),
+        help="example names (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--make",
+        action="store_true",
+        help=f"rebuild the ROMs with `{LOG_USERFLAGS}` first",
+    )
+    parser.add_argument(
+        "--emulator",
+        default="mgba-headless -l 255 --script {script} {rom}",
+        help="emulator command, where `{script}` & `{rom}` are replaced (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--timeout",
+        type=float,
+        default=120,
+        help="seconds per ROM (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--output", type=Path, default=Path("frame_times.json"), help="JSON output path"
+    )
+    parser.add_argument(
+        "--baseline", type=Path, help="previous JSON output to compare with"
+    )
+    parser.add_argument(
+        "--tolerance",
+        type=float,
+        default=1.0,
+        help="allowed increase of max & p99, in percent of a frame (default: %(default)s)",
+    )
+    args = parser.parse_args()
+
+    emulator = shlex.split(args.emulator)
+    results: dict = {}
+
+    for rom in args.roms:
+        example_path = EXAMPLES_PATH / rom
+        if args.make:
+            subprocess.run(["make", "-C", str(example_path), "clean"], check=True)
+            subprocess.run(
+                ["make", "-C", str(example_path), "-j", f"USERFLAGS={LOG_USERFLAGS}"],
+                check=True,
+            )
+
+        events = parse_inputs(INPUTS_PATH / f"{rom}.txt")
+        usages = run_rom(emulator, example_path / f"{rom}.gba", events, args.timeout)
+
+        all_usages = [
+            usage for segment_usages in usages.values() for usage in segment_usages
+        ]
+        results[rom] = {
+            "total": summarize(all_usages),
+            "segments": {
+                segment: summarize(segment_usages)
+                for segment, segment_usages in usages.items()
+            },
+        }
+
+        total = results[rom]["total"]
+        print(
+            f"{rom}: mean {total['mean']}%, p99 {total['p99']}%, max {total['max']}% ({total['frames']} frames)"
+        )
+
+    args.output.write_text(json.dumps(results, indent=2, sort_keys=True) + "\n")
+
+    if args.baseline:
+        regressions = find_regressions(
+            results, json.loads(args.baseline.read_text()), args.tolerance
+        )
+        for regression in regressions:
+            print(f"Regression: {regression}", file=sys.stderr)
+        if regressions:
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,797 @@
+#!/usr/bin/env python
+
+# SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+# SPDX-License-Identifier: Zlib
+
+"""
+Generates a synthetic LDtk 1.5.3 project.
+
+The `streaming` preset is for the BG streaming benchmarks,
+with a level for each grid size (8/16/24/32 px) x cell storage (`u8`/`u16`) x flip density (0%/50%),
+an out-of-bound heavy level smaller than the screen, and a level of 4 parallax layers.
+
+The `scaling` preset is for the converter benchmarks (`bench_converter.py`),
+with the level count, level size, layer count, tile density, entity count and field count as parameters.
+
+Usage: python synthetic_ldtk.py --output <folder> [--seed 0] [--preset streaming]
+       python synthetic_ldtk.py --output <folder> --preset scaling [--levels 4] [--level-size 512 256] [--layers 2]
+                                [--tile-density 100] [--entities 16] [--fields 4]
+"""
+
+from io import BytesIO
+from PIL import Image
+from typing import Any, Dict, List, NamedTuple
+import argparse
+import json
+import random
+import uuid
+from pathlib import Path
+
+LDTK_VERSION = "1.5.3"
+PROJECT_FILE_NAME = "synthetic.ldtk"
+
+GRID_SIZES = (8, 16, 24, 32)
+TILESET_COLUMNS = 16
+
+# Level size divisible by every grid size
+LEVEL_PX_WIDTH = 1152
+LEVEL_PX_HEIGHT = 768
+
+# Smaller than the screen, so that most of the screen is out-of-bound
+OOB_LEVEL_PX_WIDTH = 160
+OOB_LEVEL_PX_HEIGHT = 96
+
+# Tile indexes of a tileset stay under `1 << 6` with these many tiles, so that the cells are stored as `u8`
+U8_TILESET_ROWS = 3
+U16_TILESET_ROWS = 16
+
+PALETTE = [
+    (0x00, 0x00, 0x00),
+    (0x1D, 0x2B, 0x53),
+    (0x7E, 0x25, 0x53),
+    (0x00, 0x87, 0x51),
+    (0xAB, 0x52, 0x36),
+    (0x5F, 0x57, 0x4F),
+    (0xC2, 0xC3, 0xC7),
+    (0xFF, 0xF1, 0xE8),
+    (0xFF, 0x00, 0x4D),
+    (0xFF, 0xA3, 0x00),
+    (0xFF, 0xEC, 0x27),
+    (0x00, 0xE4, 0x36),
+    (0x29, 0xAD, 0xFF),
+    (0x83, 0x76, 0x9C),
+    (0xFF, 0x77, 0xA8),
+]
+PATTERNS_COUNT = 32
+
+# Entity definitions of the `scaling` preset, which the entities of a level cycle through
+ENTITY_DEFS_COUNT = 4
+ENTITY_SIZE = 16
+ARRAY_FIELD_LENGTH = 4
+
+# Field types of the entity definitions, which the fields cycle through: (`__type`, `type`, `isArray`)
+FIELD_TYPES = [
+    ("Int", "F_Int", False),
+    ("Float", "F_Float", False),
+    ("Bool", "F_Bool", False),
+    ("String", "F_String", False),
+    ("Color", "F_Color", False),
+    ("Point", "F_Point", False),
+    ("Array<Int>", "F_Int", True),
+    ("Array<Point>", "F_Point", True),
+]
+
+
+class TilesetSpec(NamedTuple):
+    identifier: str
+    grid_size: int
+    rows: int
+
+
+class LayerSpec(NamedTuple):
+    identifier: str
+    tileset: TilesetSpec
+    parallax_factor: float
+
+
+class LevelSpec(NamedTuple):
+    identifier: str
+    px_width: int
+    px_height: int
+    layers: List[str]
+    flip_percent: int
+    tile_percent: int = 100
+    entities: int = 0
+
+
+class ScalingParams(NamedTuple):
+    """Parameters of the `scaling` preset"""
+
+    levels: int = 4
+    level_px_width: int = 512
+    level_px_height: int = 256
+    layers: int = 2
+    tile_percent: int = 100
+    entities: int = 16
+    fields: int = 4
+
+
+STORAGES = (("u8", U8_TILESET_ROWS), ("u16", U16_TILESET_ROWS))
+
+# Cell storage is decided by the tile indexes of the whole tileset, so each storage has its own tilesets
+TILESETS = [
+    TilesetSpec(f"tileset_{grid}_{storage}", grid, rows)
+    for storage, rows in STORAGES
+    for grid in GRID_SIZES
+]
+
+
+def find_tileset(identifier: str) -> TilesetSpec:
+    return next(tileset for tileset in TILESETS if tileset.identifier == identifier)
+
+
+# Layers with no parallax for each tileset, and 3 more 16 px ones for the 4 parallax layers level
+LAYERS = [
+    LayerSpec(tileset.identifier.replace("tileset", "tiles"), tileset, 0)
+    for tileset in TILESETS
+] + [
+    LayerSpec(f"parallax_{percent}", find_tileset("tileset_16_u8"), percent / 100)
+    for percent in (25, 50, 75)
+]
+
+
+def make_level_specs() -> List[LevelSpec]:
+    specs: List[LevelSpec] = []
+    for storage, _ in STORAGES:
+        for grid in GRID_SIZES:
+            for flip_percent in (0, 50):
+                specs.append(
+                    LevelSpec(
+                        f"g{grid}_{storage}_flip{flip_percent}",
+                        LEVEL_PX_WIDTH,
+                        LEVEL_PX_HEIGHT,
+                        [f"tiles_{grid}_{storage}"],
+                        flip_percent,
+                    )
+                )
+    specs.append(
+        LevelSpec(
+            "oob_g16",
+            OOB_LEVEL_PX_WIDTH,
+            OOB_LEVEL_PX_HEIGHT,
+            ["tiles_16_u8"],
+            50,
+        )
+    )
+    specs.append(
+        LevelSpec(
+            "parallax_x4",
+            LEVEL_PX_WIDTH,
+            LEVEL_PX_HEIGHT,
+            ["tiles_16_u8", "parallax_25", "parallax_50", "parallax_75"],
+            0,
+        )
+    )
+    return specs
+
+
+def make_scaling_layer_specs(params: ScalingParams) -> List[LayerSpec]:
+    if not 1 <= params.layers <= 4:
+        raise ValueError(f"Layer count must be in [1..4], but it's {params.layers}")
+
+    return [
+        LayerSpec(f"tiles_{idx}", find_tileset("tileset_16_u16"), 0)
+        for idx in range(params.layers)
+    ]
+
+
+def make_scaling_level_specs(params: ScalingParams) -> List[LevelSpec]:
+    layers = [spec.identifier for spec in make_scaling_layer_specs(params)]
+    return [
+        LevelSpec(
+            f"level_{idx}",
+            params.level_px_width,
+            params.level_px_height,
+            layers,
+            25,
+            params.tile_percent,
+            params.entities,
+        )
+        for idx in range(params.levels)
+    ]
+
+
+class UidGenerator:
+    def __init__(self, rand: random.Random):
+        self.rand = rand
+        self.next_uid = 0
+
+    def uid(self) -> int:
+        self.next_uid += 1
+        return self.next_uid - 1
+
+    def iid(self) -> str:
+        return str(uuid.UUID(int=self.rand.getrandbits(128)))
+
+
+def make_tileset_image(spec: TilesetSpec) -> Image.Image:
+    """Every tile is a different mix of a few 8x8 patterns, so that they're distinct but deduplicate well"""
+    patterns: List[Image.Image] = []
+    for p in range(PATTERNS_COUNT):
+        pattern = Image.new("RGBA", (8, 8))
+        for y in range(8):
+            for x in range(8):
+                color = PALETTE[1 + (x * (p % 4 + 1) + y * (p // 4 + 1) + p) % 14]
+                pattern.putpixel((x, y), (*color, 255))
+        patterns.append(pattern)
+
+    grid_size = spec.grid_size
+    image = Image.new("RGBA", (TILESET_COLUMNS * grid_size, spec.rows * grid_size))
+    sub_count = grid_size >> 3
+    for tile_id in range(TILESET_COLUMNS * spec.rows):
+        tile_x = (tile_id % TILESET_COLUMNS) * grid_size
+        tile_y = (tile_id // TILESET_COLUMNS) * grid_size
+        for sy in range(sub_count):
+            for sx in range(sub_count):
+                pattern = patterns[(tile_id * 7 + sx * 3 + sy * 5) % PATTERNS_COUNT]
+                image.paste(pattern, (tile_x + sx * 8, tile_y + sy * 8))
+    return image
+
+
+def make_tileset_def(uids: UidGenerator, spec: TilesetSpec) -> Dict[str, Any]:
+    return {
+        "__cWid": TILESET_COLUMNS,
+        "__cHei": spec.rows,
+        "identifier": spec.identifier,
+        "uid": uids.uid(),
+        "relPath": f"{spec.identifier}.png",
+        "embedAtlas": None,
+        "pxWid": TILESET_COLUMNS * spec.grid_size,
+        "pxHei": spec.rows * spec.grid_size,
+        "tileGridSize": spec.grid_size,
+        "spacing": 0,
+        "padding": 0,
+        "tags": [],
+        "tagsSourceEnumUid": None,
+        "enumTags": [],
+        "customData": [],
+        "savedSelections": [],
+        "cachedPixelData": None,
+    }
+
+
+def make_layer_def(
+    uids: UidGenerator, spec: LayerSpec, tileset_uid: int
+) -> Dict[str, Any]:
+    return {
+        "__type": "Tiles",
+        "identifier": spec.identifier,
+        "type": "Tiles",
+        "uid": uids.uid(),
+        "doc": None,
+        "uiColor": None,
+        "gridSize": spec.tileset.grid_size,
+        "guideGridWid": 0,
+        "guideGridHei": 0,
+        "displayOpacity": 1,
+        "inactiveOpacity": 1,
+        "hideInList": False,
+        "hideFieldsWhenInactive": False,
+        "canSelectWhenInactive": True,
+        "renderInWorldView": True,
+        "pxOffsetX": 0,
+        "pxOffsetY": 0,
+        "parallaxFactorX": spec.parallax_factor,
+        "parallaxFactorY": spec.parallax_factor,
+        "parallaxScaling": False,
+        "requiredTags": [],
+        "excludedTags": [],
+        "autoTilesKilledByOtherLayerUid": None,
+        "uiFilterTags": [],
+        "useAsyncRender": False,
+        "intGridValues": [],
+        "intGridValuesGroups": [],
+        "autoRuleGroups": [],
+        "autoSourceLayerDefUid": None,
+        "tilesetDefUid": tileset_uid,
+        "tilePivotX": 0,
+        "tilePivotY": 0,
+        "biomeFieldUid": None,
+    }
+
+
+def make_entity_layer_def(uids: UidGenerator) -> Dict[str, Any]:
+    return {
+        "__type": "Entities",
+        "identifier": "entities",
+        "type": "Entities",
+        "uid": uids.uid(),
+        "doc": None,
+        "uiColor": None,
+        "gridSize": ENTITY_SIZE,
+        "guideGridWid": 0,
+        "guideGridHei": 0,
+        "displayOpacity": 1,
+        "inactiveOpacity": 1,
+        "hideInList": False,
+        "hideFieldsWhenInactive": True,
+        "canSelectWhenInactive": True,
+        "renderInWorldView": True,
+        "pxOffsetX": 0,
+        "pxOffsetY": 0,
+        "parallaxFactorX": 0,
+        "parallaxFactorY": 0,
+        "parallaxScaling": True,
+        "requiredTags": [],
+        "excludedTags": [],
+        "autoTilesKilledByOtherLayerUid": None,
+        "uiFilterTags": [],
+        "useAsyncRender": False,
+        "intGridValues": [],
+        "intGridValuesGroups": [],
+        "autoRuleGroups": [],
+        "autoSourceLayerDefUid": None,
+        "tilesetDefUid": None,
+        "tilePivotX": 0,
+        "tilePivotY": 0,
+        "biomeFieldUid": None,
+    }
+
+
+def make_field_def(uids: UidGenerator, field_idx: int) -> Dict[str, Any]:
+    display_type, field_type, is_array = FIELD_TYPES[field_idx % len(FIELD_TYPES)]
+    return {
+        "identifier": f"field_{field_idx}",
+        "doc": None,
+        "__type": display_type,
+        "uid": uids.uid(),
+        "type": field_type,
+        "isArray": is_array,
+        "canBeNull": False,
+        "arrayMinLength": None,
+        "arrayMaxLength": None,
+        "editorDisplayMode": "Hidden",
+        "editorDisplayScale": 1,
+        "editorDisplayPos": "Above",
+        "editorLinkStyle": "StraightArrow",
+        "editorDisplayColor": None,
+        "editorAlwaysShow": False,
+        "editorShowInWorld": True,
+        "editorCutLongValues": True,
+        "editorTextSuffix": None,
+        "editorTextPrefix": None,
+        "useForSmartColor": False,
+        "exportToToc": False,
+        "searchable": False,
+        "min": None,
+        "max": None,
+        "regex": None,
+        "acceptFileTypes": None,
+        "defaultOverride": None,
+        "textLanguageMode": None,
+        "symmetricalRef": False,
+        "autoChainRef": True,
+        "allowOutOfLevelRef": True,
+        "allowedRefs": "OnlySame",
+        "allowedRefsEntityUid": None,
+        "allowedRefTags": [],
+        "tilesetUid": None,
+    }
+
+
+def make_entity_def(uids: UidGenerator, entity_idx: int, fields: int) -> Dict[str, Any]:
+    return {
+        "identifier": f"entity_{entity_idx}",
+        "uid": uids.uid(),
+        "tags": [],
+        "exportToToc": False,
+        "allowOutOfBounds": False,
+        "doc": None,
+        "width": ENTITY_SIZE,
+        "height": ENTITY_SIZE,
+        "resizableX": False,
+        "resizableY": False,
+        "minWidth": None,
+        "maxWidth": None,
+        "minHeight": None,
+        "maxHeight": None,
+        "keepAspectRatio": False,
+        "tileOpacity": 1,
+        "fillOpacity": 1,
+        "lineOpacity": 1,
+        "hollow": False,
+        "color": "#BE4A2F",
+        "renderMode": "Rectangle",
+        "showName": True,
+        "tilesetId": None,
+        "tileRenderMode": "FitInside",
+        "tileRect": None,
+        "uiTileRect": None,
+        "nineSliceBorders": [],
+        "maxCount": 0,
+        "limitScope": "PerLevel",
+        "limitBehavior": "MoveLastOne",
+        "pivotX": 0,
+        "pivotY": 0,
+        "fieldDefs": [make_field_def(uids, field_idx) for field_idx in range(fields)],
+    }
+
+
+def make_field_value(
+    rand: random.Random, field_type: str, c_wid: int, c_hei: int
+) -> Any:
+    if field_type == "F_Int":
+        return rand.randrange(-1000, 1000)
+    if field_type == "F_Float":
+        return rand.randrange(-1000, 1000) / 8
+    if field_type == "F_Bool":
+        return rand.randrange(2) == 1
+    if field_type == "F_String":
+        return f"text_{rand.randrange(1000)}"
+    if field_type == "F_Color":
+        return f"#{rand.randrange(1 << 24):06X}"
+    if field_type == "F_Point":
+        return {"cx": rand.randrange(c_wid), "cy": rand.randrange(c_hei)}
+    raise ValueError(f"Unknown field type {field_type}")
+
+
+def make_entity_instances(
+    uids: UidGenerator,
+    rand: random.Random,
+    level: LevelSpec,
+    entity_defs: List[Dict[str, Any]],
+) -> List[Dict[str, Any]]:
+    c_wid = level.px_width // ENTITY_SIZE
+    c_hei = level.px_height // ENTITY_SIZE
+    entity_instances: List[Dict[str, Any]] = []
+    for entity_idx in range(level.entities):
+        entity_def = entity_defs[entity_idx % len(entity_defs)]
+        cx, cy = rand.randrange(c_wid), rand.randrange(c_hei)
+
+        field_instances: List[Dict[str, Any]] = []
+        for field_def in entity_def["fieldDefs"]:
+            if field_def["isArray"]:
+                value: Any = [
+                    make_field_value(rand, field_def["type"], c_wid, c_hei)
+                    for _ in range(ARRAY_FIELD_LENGTH)
+                ]
+            else:
+                value = make_field_value(rand, field_def["type"], c_wid, c_hei)
+            field_instances.append(
+                {
+                    "__identifier": field_def["identifier"],
+                    "__type": field_def["__type"],
+                    "__value": value,
+                    "__tile": None,
+                    "defUid": field_def["uid"],
+                    "realEditorValues": [],
+                }
+            )
+
+        entity_instances.append(
+            {
+                "__identifier": entity_def["identifier"],
+                "__grid": [cx, cy],
+                "__pivot": [0, 0],
+                "__tags": [],
+                "__tile": None,
+                "__smartColor": "#BE4A2F",
+                "iid": uids.iid(),
+                "width": ENTITY_SIZE,
+                "height": ENTITY_SIZE,
+                "defUid": entity_def["uid"],
+                "px": [cx * ENTITY_SIZE, cy * ENTITY_SIZE],
+                "fieldInstances": field_instances,
+            }
+        )
+    return entity_instances
+
+
+def make_grid_tiles(
+    rand: random.Random, level: LevelSpec, tileset_def: Dict[str, Any]
+) -> List[Dict[str, Any]]:
+    grid_size: int = tileset_def["tileGridSize"]
+    tiles_count: int = tileset_def["__cWid"] * tileset_def["__cHei"]
+    c_wid = level.px_width // grid_size
+    c_hei = level.px_height // grid_size
+    grid_tiles: List[Dict[str, Any]] = []
+    for cy in range(c_hei):
+        for cx in range(c_wid):
+            if level.tile_percent < 100 and rand.randrange(100) >= level.tile_percent:
+                continue
+            tile_id = rand.randrange(tiles_count)
+            flip = (
+                rand.randrange(1, 4) if rand.randrange(100) < level.flip_percent else 0
+            )
+            grid_tiles.append(
+                {
+                    "px": [cx * grid_size, cy * grid_size],
+                    "src": [
+                        (tile_id % TILESET_COLUMNS) * grid_size,
+                        (tile_id // TILESET_COLUMNS) * grid_size,
+                    ],
+                    "f": flip,
+                    "t": tile_id,
+                    "d": [cy * c_wid + cx],
+                    "a": 1,
+                }
+            )
+    return grid_tiles
+
+
+def make_level(
+    uids: UidGenerator,
+    rand: random.Random,
+    spec: LevelSpec,
+    world_x: int,
+    layer_defs: List[Dict[str, Any]],
+    tileset_defs: Dict[int, Dict[str, Any]],
+    entity_defs: List[Dict[str, Any]],
+) -> Dict[str, Any]:
+    level_uid = uids.uid()
+    layer_instances: List[Dict[str, Any]] = []
+    for layer_def in layer_defs:
+        grid_size: int = layer_def["gridSize"]
+        is_entities = layer_def["type"] == "Entities"
+        tileset_def = None if is_entities else tileset_defs[layer_def["tilesetDefUid"]]
+        layer_instances.append(
+            {
+                "__identifier": layer_def["identifier"],
+                "__type": layer_def["type"],
+                "__cWid": -(-spec.px_width // grid_size),
+                "__cHei": -(-spec.px_height // grid_size),
+                "__gridSize": grid_size,
+                "__opacity": 1,
+                "__pxTotalOffsetX": 0,
+                "__pxTotalOffsetY": 0,
+                "__tilesetDefUid": tileset_def["uid"] if tileset_def else None,
+                "__tilesetRelPath": tileset_def["relPath"] if tileset_def else None,
+                "iid": uids.iid(),
+                "levelId": level_uid,
+                "layerDefUid": layer_def["uid"],
+                "pxOffsetX": 0,
+                "pxOffsetY": 0,
+                "visible": True,
+                "optionalRules": [],
+                "intGridCsv": [],
+                "autoLayerTiles": [],
+                "seed": rand.randrange(1 << 24),
+                "overrideTilesetUid": None,
+                "gridTiles": (
+                    make_grid_tiles(rand, spec, tileset_def)
+                    if tileset_def and layer_def["identifier"] in spec.layers
+                    else []
+                ),
+                "entityInstances": (
+                    make_entity_instances(uids, rand, spec, entity_defs)
+                    if is_entities
+                    else []
+                ),
+            }
+        )
+
+    return {
+        "identifier": spec.identifier,
+        "iid": uids.iid(),
+        "uid": level_uid,
+        "worldX": world_x,
+        "worldY": 0,
+        "worldDepth": 0,
+        "pxWid": spec.px_width,
+        "pxHei": spec.px_height,
+        "__bgColor": "#1D2B53",
+        "bgColor": None,
+        "useAutoIdentifier": False,
+        "bgRelPath": None,
+        "bgPos": None,
+        "bgPivotX": 0.5,
+        "bgPivotY": 0.5,
+        "__smartColor": "#8E95A9",
+        "__bgPos": None,
+        "externalRelPath": None,
+        "fieldInstances": [],
+        "__neighbours": [],
+        # Top layer first
+        "layerInstances": list(reversed(layer_instances)),
+    }
+
+
+def used_tilesets(layer_specs: List[LayerSpec]) -> List[TilesetSpec]:
+    identifiers = {spec.tileset.identifier for spec in layer_specs}
+    return [spec for spec in TILESETS if spec.identifier in identifiers]
+
+
+def make_project(
+    rand: random.Random,
+    level_specs: List[LevelSpec],
+    layer_specs: List[LayerSpec],
+    fields: int = 0,
+) -> Dict[str, Any]:
+    uids = UidGenerator(rand)
+
+    tileset_defs: Dict[int, Dict[str, Any]] = {}
+    tileset_uids: Dict[str, int] = {}
+    for spec in used_tilesets(layer_specs):
+        tileset_def = make_tileset_def(uids, spec)
+        tileset_defs[tileset_def["uid"]] = tileset_def
+        tileset_uids[spec.identifier] = tileset_def["uid"]
+
+    layer_defs = [
+        make_layer_def(uids, spec, tileset_uids[spec.tileset.identifier])
+        for spec in layer_specs
+    ]
+
+    entity_defs: List[Dict[str, Any]] = []
+    if any(spec.entities for spec in level_specs):
+        layer_defs.append(make_entity_layer_def(uids))
+        entity_defs = [
+            make_entity_def(uids, entity_idx, fields)
+            for entity_idx in range(ENTITY_DEFS_COUNT)
+        ]
+
+    levels: List[Dict[str, Any]] = []
+    world_x = 0
+    for spec in level_specs:
+        levels.append(
+            make_level(uids, rand, spec, world_x, layer_defs, tileset_defs, entity_defs)
+        )
+        world_x += spec.px_width + 256
+
+    return {
+        "__header__": {
+            "fileType": "LDtk Project JSON",
+            "app": "LDtk",
+            "doc": "https://ldtk.io/json",
+            "schema": "https://ldtk.io/files/JSON_SCHEMA.json",
+            "appAuthor": "Sebastien 'deepnight' Benard",
+            "appVersion": LDTK_VERSION,
+            "url": "https://ldtk.io",
+        },
+        "iid": uids.iid(),
+        "jsonVersion": LDTK_VERSION,
+        "appBuildId": 473703,
+        "nextUid": uids.next_uid,
+        "identifierStyle": "Lowercase",
+        "toc": [],
+        "worldLayout": "Free",
+        "worldGridWidth": 256,
+        "worldGridHeight": 256,
+        "defaultLevelWidth": 256,
+        "defaultLevelHeight": 256,
+        "defaultPivotX": 0,
+        "defaultPivotY": 0,
+        "defaultGridSize": 16,
+        "defaultEntityWidth": 16,
+        "defaultEntityHeight": 16,
+        "bgColor": "#40465B",
+        "defaultLevelBgColor": "#1D2B53",
+        "minifyJson": True,
+        "externalLevels": False,
+        "exportTiled": False,
+        "simplifiedExport": False,
+        "imageExportMode": "None",
+        "exportLevelBg": False,
+        "pngFilePattern": None,
+        "backupOnSave": False,
+        "backupLimit": 10,
+        "backupRelPath": None,
+        "levelNamePattern": "Level_%idx",
+        "tutorialDesc": None,
+        "customCommands": [],
+        "flags": [],
+        "defs": {
+            "layers": list(reversed(layer_defs)),
+            "entities": entity_defs,
+            "tilesets": list(tileset_defs.values()),
+            "enums": [],
+            "externalEnums": [],
+            "levelFields": [],
+        },
+        "levels": levels,
+        "worlds": [],
+        "dummyWorldIid": uids.iid(),
+    }
+
+
+def write_if_changed(path: Path, data: bytes):
+    """Keeps the modification time, so that the build doesn't re-convert the same project"""
+    if path.is_file() and path.read_bytes() == data:
+        return
+    path.write_bytes(data)
+
+
+def write_project(
+    output: Path,
+    seed: int,
+    level_specs: List[LevelSpec],
+    layer_specs: List[LayerSpec],
+    fields: int = 0,
+) -> Path:
+    """Returns the path of the written project file"""
+    output.mkdir(parents=True, exist_ok=True)
+
+    for spec in used_tilesets(layer_specs):
+        image = BytesIO()
+        make_tileset_image(spec).save(image, format="PNG")
+        write_if_changed(output.joinpath(f"{spec.identifier}.png"), image.getvalue())
+
+    project = make_project(random.Random(seed), level_specs, layer_specs, fields)
+    project_path = output.joinpath(PROJECT_FILE_NAME)
+    write_if_changed(
+        project_path, json.dumps(project, separators=(",", ":")).encode("utf-8")
+    )
+    return project_path
+
+
+def write_streaming_project(output: Path, seed: int) -> Path:
+    return write_project(output, seed, make_level_specs(), LAYERS)
+
+
+def write_scaling_project(output: Path, seed: int, params: ScalingParams) -> Path:
+    return write_project(
+        output,
+        seed,
+        make_scaling_level_specs(params),
+        make_scaling_layer_specs(params),
+        params.fields,
+    )
+
+
+def main():
+    defaults = ScalingParams()
+
+    parser = argparse.ArgumentParser(description="Generate a synthetic LDtk project")
+    parser.add_argument(
+        "--output", type=Path, required=True, help="Folder to write the project to"
+    )
+    parser.add_argument("--seed", type=int, default=0, help="Random seed")
+    parser.add_argument(
+        "--preset",
+        choices=("streaming", "scaling"),
+        default="streaming",
+        help="`streaming` for the BG streaming benchmarks, `scaling` for the converter benchmarks",
+    )
+    scaling = parser.add_argument_group("scaling preset")
+    scaling.add_argument("--levels", type=int, default=defaults.levels)
+    scaling.add_argument(
+        "--level-size",
+        type=int,
+        nargs=2,
+        metavar=("WIDTH", "HEIGHT"),
+        default=(defaults.level_px_width, defaults.level_px_height),
+        help="in pixels, multiple of 16",
+    )
+    scaling.add_argument(
+        "--layers", type=int, default=defaults.layers, help="tile layers, up to 4"
+    )
+    scaling.add_argument(
+        "--tile-density",
+        type=int,
+        default=defaults.tile_percent,
+        help="percent of the cells with a tile",
+    )
+    scaling.add_argument(
+        "--entities", type=int, default=defaults.entities, help="entities per level"
+    )
+    scaling.add_argument(
+        "--fields", type=int, default=defaults.fields, help="fields per entity"
+    )
+    args = parser.parse_args()
+
+    if args.preset == "streaming":
+        write_streaming_project(args.output, args.seed)
+    else:
+        params = ScalingParams(
+            args.levels,
+            args.level_size[0],
+            args.level_size[1],
+            args.layers,
+            args.tile_density,
+            args.entities,
+            args.fields,
+        )
+        write_scaling_project(args.output, args.seed, params)
+
+
+if __name__ == "__main__":
+    main()
@@ -6,24 +6,185 @@
 from pathlib import Path
 import LdtkJson
 from gen_sources import *
-from typing import Final, Any
+from typing import (
+    Final,
+    Any,
+    Callable,
+    Deque,
+    Iterable,
+    Iterator,
+    Sequence,
+    Tuple,
+    TypeVar,
+)
+from profiler import profiler, run_profiled
+from size_report import SizeReport, TilesetSizes, lz77_compressed_size
 from PIL import Image
+import hashlib
+import io
+import json
 import math
+import os
+import struct
+
+T = TypeVar("T")
+R = TypeVar("R")
+
+
+def default_jobs() -> int:
+    return os.cpu_count() or 1
+
+
+def iter_parallel(
+    function: Callable[[T], R],
+    items: Sequence[T],
+    jobs: int,
+    initializer: Optional[Callable[..., None]] = None,
+    initargs: Iterable[Any] = (),
+) -> Iterator[R]:
+    """
+    Runs `function` on each item with up to `jobs` worker processes, and yields the results in the order of `items`.
+    Only a few items are in flight at once, so that the results not consumed yet don't pile up in memory.
+    """
+    if jobs <= 1 or len(items) <= 1:
+        if initializer is not None:
+            initializer(*initargs)
+        yield from (function(item) for item in items)
+        return
+
+    from concurrent.futures import Future, ProcessPoolExecutor
+    from collections import deque
+
+    max_in_flight = 2 * jobs
+    with ProcessPoolExecutor(
+        max_workers=min(jobs, len(items)), initializer=initializer, initargs=initargs
+    ) as executor:
+        in_flight: Deque[Future[R]] = deque()
+        for item in items:
+            if len(in_flight) == max_in_flight:
+                yield in_flight.popleft().result()
+            in_flight.append(executor.submit(function, item))
+        while in_flight:
+            yield in_flight.popleft().result()
+
+
+def run_parallel(
+    function: Callable[[T], R],
+    items: Sequence[T],
+    jobs: int,
+    initializer: Optional[Callable[..., None]] = None,
+    initargs: Iterable[Any] = (),
+) -> List[R]:
+    """
+    Runs `function` on each item with up to `jobs` worker processes.
+    Results are returned in the order of `items`, so that the output doesn't depend on the scheduling.
+    """
+    return list(iter_parallel(function, items, jobs, initializer, initargs))
 
 
 def create_folder(folder_path: Path):
     folder_path.mkdir(parents=True, exist_ok=True)
 
 
-def remove_built_files(build_folder_path: Path):
-    for path in build_folder_path.joinpath("graphics").glob("ldtk_gen_*.bmp"):
-        path.unlink(missing_ok=True)
-    for path in build_folder_path.joinpath("graphics").glob("ldtk_gen_*.json"):
-        path.unlink(missing_ok=True)
-    for path in build_folder_path.joinpath("include").glob("ldtk_gen_*.h"):
-        path.unlink(missing_ok=True)
-    for path in build_folder_path.joinpath("src").glob("ldtk_gen_*.cpp"):
-        path.unlink(missing_ok=True)
+MANIFEST_FILE_NAME: Final[str] = "ldtk_gen_manifest.json"
+PROFILE_FILE_NAME: Final[str] = "ldtk_gen_profile.json"
+
+
+def built_file_paths(build_folder_path: Path) -> Generator[Path, None, None]:
+    yield from build_folder_path.joinpath("graphics").glob("ldtk_gen_*.bmp")
+    yield from build_folder_path.joinpath("graphics").glob("ldtk_gen_*.json")
+    yield from build_folder_path.joinpath("include").glob("ldtk_gen_*.h")
+    yield from build_folder_path.joinpath("include").glob(
+        "bn_regular_bg_items_ldtk_gen_*.h"
+    )
+    yield from build_folder_path.joinpath("src").glob("ldtk_gen_*.cpp")
+    yield from build_folder_path.joinpath("src").glob("ldtk_gen_*.s")
+    yield from build_folder_path.joinpath("incbin").glob("ldtk_gen_*.bin")
+
+
+def remove_stale_built_files(build_folder_path: Path):
+    """Removes the built files which are not generated in this conversion (e.g. of a removed level)"""
+    for path in built_file_paths(build_folder_path):
+        if path.resolve() not in generated_file_paths:
+            path.unlink(missing_ok=True)
+
+
+def hash_file(file_path: Path) -> str:
+    return hashlib.sha1(file_path.read_bytes()).hexdigest()
+
+
+def hash_inputs(
+    ldtk_project_file_path: Path, options: Dict[str, Any]
+) -> Dict[str, str]:
+    """
+    Content hashes of the LDtk project, external levels, tileset images, converter scripts and the options.
+
+    Only the paths are read from the project here, so that it's cheap enough to do on every build.
+    """
+    ldtk_project_folder_path = ldtk_project_file_path.parent
+    with open(ldtk_project_file_path, encoding="utf-8") as ldtk_project_file:
+        ldtk_project_raw_dict: dict[Any, Any] = json.load(ldtk_project_file)
+
+    input_paths: List[Path] = [ldtk_project_file_path]
+    for level in ldtk_project_raw_dict.get("levels", []):
+        if level.get("externalRelPath") is not None:
+            input_paths.append(
+                ldtk_project_folder_path.joinpath(level["externalRelPath"])
+            )
+    for tileset in ldtk_project_raw_dict.get("defs", {}).get("tilesets", []):
+        if tileset.get("relPath") is not None:
+            input_paths.append(ldtk_project_folder_path.joinpath(tileset["relPath"]))
+    input_paths.extend(sorted(Path(__file__).parent.glob("*.py")))
+
+    result: Dict[str, str] = {
+        "options": hashlib.sha1(
+            json.dumps(options, sort_keys=True).encode("utf-8")
+        ).hexdigest()
+    }
+    for input_path in input_paths:
+        # Missing file is reported later by the conversion itself
+        result[input_path.resolve().as_posix()] = (
+            hash_file(input_path) if input_path.exists() else ""
+        )
+    return result
+
+
+def is_process_required(build_folder_path: Path, input_hashes: Dict[str, str]) -> bool:
+    """Compares the content hashes with the manifest of the last conversion, instead of the modified times"""
+    manifest_path = build_folder_path.joinpath(MANIFEST_FILE_NAME)
+    if not manifest_path.exists():
+        return True
+
+    try:
+        with manifest_path.open(encoding="utf-8") as manifest_file:
+            manifest: dict[str, Any] = json.load(manifest_file)
+    except ValueError:
+        return True
+
+    if manifest.get("inputs") != input_hashes:
+        return True
+
+    # Built files could be modified or removed by hand
+    for output_path, output_hash in manifest.get("outputs", {}).items():
+        path = build_folder_path.joinpath(output_path)
+        if not path.exists() or hash_file(path) != output_hash:
+            return True
+
+    return False
+
+
+def write_manifest(build_folder_path: Path, input_hashes: Dict[str, str]):
+    manifest = {
+        "inputs": input_hashes,
+        "outputs": {
+            path.relative_to(build_folder_path.resolve()).as_posix(): hash_file(path)
+            for path in sorted(generated_file_paths)
+        },
+    }
+    write_if_changed(
+        build_folder_path.joinpath(MANIFEST_FILE_NAME),
+        json.dumps(manifest, indent=2).encode("utf-8"),
+    )
 
 
 def layer_def_has_visible_tiles(layer: LdtkJson.LayerDefinition) -> bool:
@@ -34,9 +195,70 @@ def layer_def_has_visible_tiles(layer: LdtkJson.LayerDefinition) -> bool:
     )
 
 
-def load_ldtk_project(ldtk_project_file_path: Path) -> LdtkJson.LdtkJSON:
-    import json
-
+def load_ldtk_level(ldtk_level_file_path: Path) -> LdtkJson.Level:
+    with open(ldtk_level_file_path, encoding="utf-8") as ldtk_level_file:
+        ldtk_level_raw_dict: dict[Any, Any] = json.load(ldtk_level_file)
+        return LdtkJson.Level.from_dict(ldtk_level_raw_dict)
+
+
+def slim_layer_tiles(
+    tiles: List[LdtkJson.TileInstance], layer: LdtkJson.LayerInstance
+) -> List[LdtkJson.TileInstance]:
+    """
+    Keeps only the tiles that the checks & `TilesetInfos` look at:
+    The first unaligned tile, and a topmost in-bound tile for each used tile src.
+    An empty layer stays empty, and a non-empty one stays non-empty.
+    """
+    slim_tiles: List[LdtkJson.TileInstance] = []
+    unaligned_tile = next(
+        (
+            tile
+            for tile in tiles
+            if tile.px[0] % layer.grid_size != 0 or tile.px[1] % layer.grid_size != 0
+        ),
+        None,
+    )
+    if unaligned_tile is not None:
+        slim_tiles.append(unaligned_tile)
+
+    topmost_tiles: List[LdtkJson.TileInstance] = []
+    used_pos: Set[Point] = set()
+    used_srcs: Set[Point] = set()
+    # Reversed, as the last tile is the topmost one in the same grid pos
+    for tile in reversed(tiles):
+        pos = Point(tile.px[0] // layer.grid_size, tile.px[1] // layer.grid_size)
+        if pos.x < 0 or pos.x >= layer.c_wid or pos.y < 0 or pos.y >= layer.c_hei:
+            continue
+        if pos in used_pos:
+            continue
+        used_pos.add(pos)
+        src = Point(tile.src[0], tile.src[1])
+        if src not in used_srcs:
+            used_srcs.add(src)
+            topmost_tiles.append(tile)
+    # Restores the original order, so that the used tiles are found in the same order
+    slim_tiles.extend(reversed(topmost_tiles))
+
+    if tiles and not slim_tiles:
+        slim_tiles.append(tiles[0])
+    return slim_tiles
+
+
+def load_slim_ldtk_level(ldtk_level_file_path: Path) -> LdtkJson.Level:
+    """
+    Runs in a worker process; Loads the external level without most of its tiles, which dominate the memory usage.
+
+    The cells are parsed later by reloading the level file, one level at a time.
+    """
+    level = load_ldtk_level(ldtk_level_file_path)
+    assert level.layer_instances is not None
+    for layer in level.layer_instances:
+        layer.auto_layer_tiles = slim_layer_tiles(layer.auto_layer_tiles, layer)
+        layer.grid_tiles = slim_layer_tiles(layer.grid_tiles, layer)
+    return level
+
+
+def load_ldtk_project(ldtk_project_file_path: Path, jobs: int = 1) -> LdtkJson.LdtkJSON:
     ldtk_project_folder_path: Path = ldtk_project_file_path.parent
 
     with open(ldtk_project_file_path, encoding="utf-8") as ldtk_project_file:
@@ -50,57 +272,24 @@ def load_ldtk_project(ldtk_project_file_path: Path) -> LdtkJson.LdtkJSON:
 
         ldtk_project = LdtkJson.ldtk_json_from_dict(ldtk_project_raw_dict)
 
-        # Load all external levels
-        levels: List[LdtkJson.Level] = []
-        for level in ldtk_project.levels:
-            if level.external_rel_path is None:
-                levels.append(level)
-            else:
-                level_path = ldtk_project_folder_path.joinpath(level.external_rel_path)
-                with open(level_path, encoding="utf-8") as ldtk_level_file:
-                    ldtk_level_raw_dict: dict[Any, Any] = json.load(ldtk_level_file)
-                    ext_level = LdtkJson.Level.from_dict(ldtk_level_raw_dict)
-                    levels.append(ext_level)
-
-        ldtk_project.levels = levels
+        # Load all external levels without most of their tiles
+        ext_level_paths: List[Path] = [
+            ldtk_project_folder_path.joinpath(level.external_rel_path)
+            for level in ldtk_project.levels
+            if level.external_rel_path is not None
+        ]
+        ext_levels = iter(run_parallel(load_slim_ldtk_level, ext_level_paths, jobs))
+
+        for level_idx, level in enumerate(ldtk_project.levels):
+            if level.external_rel_path is not None:
+                ext_level = next(ext_levels)
+                # Kept to reload the level for its cells later
+                ext_level.external_rel_path = level.external_rel_path
+                ldtk_project.levels[level_idx] = ext_level
 
         return ldtk_project
 
 
-def load_ldtk_project_if_process_required(
-    ldtk_project_file_path: Path, build_folder_path: Path
-) -> Optional[LdtkJson.LdtkJSON]:
-    gen_project_header_path = build_folder_path.joinpath("include/ldtk_gen_project.h")
-    tools_path = Path(__file__).parent
-
-    if not gen_project_header_path.exists():
-        return load_ldtk_project(ldtk_project_file_path)
-
-    source_project_modified_time = ldtk_project_file_path.stat().st_mtime
-    gen_project_modified_time = gen_project_header_path.stat().st_mtime
-
-    if source_project_modified_time >= gen_project_modified_time:
-        return load_ldtk_project(ldtk_project_file_path)
-    for script_path in tools_path.glob("*.py"):
-        script_modified_time = script_path.stat().st_mtime
-        if script_modified_time >= gen_project_modified_time:
-            return load_ldtk_project(ldtk_project_file_path)
-
-    ldtk_project_folder_path = ldtk_project_file_path.parent
-    ldtk_project = load_ldtk_project(ldtk_project_file_path)
-
-    for tileset in ldtk_project.defs.tilesets:
-        if tileset.rel_path is None:
-            continue
-
-        tileset_file_path = ldtk_project_folder_path.joinpath(tileset.rel_path)
-        tileset_modified_time = tileset_file_path.stat().st_mtime
-        if tileset_modified_time >= gen_project_modified_time:
-            return ldtk_project
-
-    return None
-
-
 def ensure_identifier_style_lowercase(ldtk_project: LdtkJson.LdtkJSON):
     if ldtk_project.identifier_style != LdtkJson.IdentifierStyle.LOWERCASE:
         raise IdentifierStyleNotLowercase(str(ldtk_project.identifier_style))
@@ -269,15 +458,133 @@ def purge_ignore_tilesets(
                 layer.grid_tiles = []
 
 
+INT16_MIN: Final[int] = -(2**15)
+INT16_MAX: Final[int] = 2**15 - 1
+UINT16_MAX: Final[int] = 2**16 - 1
+
+
+def raise_if_not_int16(name: str, value: int, option: str, source: str):
+    if not INT16_MIN <= value <= INT16_MAX:
+        raise ValueOutOfRangeException(
+            name, value, INT16_MIN, INT16_MAX, option, source
+        )
+
+
+def raise_if_not_uint16(name: str, value: int, option: str, source: str):
+    if not 0 <= value <= UINT16_MAX:
+        raise ValueOutOfRangeException(name, value, 0, UINT16_MAX, option, source)
+
+
+def ensure_compact_representable(ldtk_project: LdtkJson.LdtkJSON):
+    OPTION: Final[str] = "--compact"
+
+    level_field_pool_size = 0
+    entity_pool_size = 0
+    entity_field_pool_size = 0
+
+    for level in ldtk_project.levels:
+        if level.layer_instances is None:
+            raise NoLayerException()
+
+        level_source = f'Level "{level.identifier}"'
+        raise_if_not_uint16("Level width", level.px_wid, OPTION, level_source)
+        raise_if_not_uint16("Level height", level.px_hei, OPTION, level_source)
+        raise_if_not_int16("Level world depth", level.world_depth, OPTION, level_source)
+        raise_if_not_uint16(
+            "Level field pool offset", level_field_pool_size, OPTION, level_source
+        )
+        level_field_pool_size += len(level.field_instances)
+
+        for layer in level.layer_instances:
+            layer_source = f'{level_source}, Layer "{layer.identifier}"'
+            raise_if_not_uint16("Layer cell width", layer.c_wid, OPTION, layer_source)
+            raise_if_not_uint16("Layer cell height", layer.c_hei, OPTION, layer_source)
+            raise_if_not_int16(
+                "Layer total offset x", layer.px_total_offset_x, OPTION, layer_source
+            )
+            raise_if_not_int16(
+                "Layer total offset y", layer.px_total_offset_y, OPTION, layer_source
+            )
+            raise_if_not_uint16(
+                "Entity pool offset", entity_pool_size, OPTION, layer_source
+            )
+            raise_if_not_uint16(
+                "Entity count", len(layer.entity_instances), OPTION, layer_source
+            )
+            entity_pool_size += len(layer.entity_instances)
+
+            for entity in layer.entity_instances:
+                entity_source = f'{layer_source}, Entity "{entity.iid}"'
+                raise_if_not_int16(
+                    "Entity grid x", entity.grid[0], OPTION, entity_source
+                )
+                raise_if_not_int16(
+                    "Entity grid y", entity.grid[1], OPTION, entity_source
+                )
+                raise_if_not_int16("Entity px x", entity.px[0], OPTION, entity_source)
+                raise_if_not_int16("Entity px y", entity.px[1], OPTION, entity_source)
+                raise_if_not_uint16("Entity width", entity.width, OPTION, entity_source)
+                raise_if_not_uint16(
+                    "Entity height", entity.height, OPTION, entity_source
+                )
+                raise_if_not_uint16(
+                    "Entity field pool offset",
+                    entity_field_pool_size,
+                    OPTION,
+                    entity_source,
+                )
+                entity_field_pool_size += len(entity.field_instances)
+
+
+def ensure_entity_tables_representable(ldtk_project: LdtkJson.LdtkJSON):
+    OPTION: Final[str] = "--entity-tables"
+
+    for level in ldtk_project.levels:
+        if level.layer_instances is None:
+            raise NoLayerException()
+
+        for layer in level.layer_instances:
+            for entity in layer.entity_instances:
+                source = f'Level "{level.identifier}", Layer "{layer.identifier}", Entity "{entity.iid}"'
+                raise_if_not_int16("Entity px x", entity.px[0], OPTION, source)
+                raise_if_not_int16("Entity px y", entity.px[1], OPTION, source)
+                raise_if_not_uint16("Entity width", entity.width, OPTION, source)
+                raise_if_not_uint16("Entity height", entity.height, OPTION, source)
+
+
 def ensure_no_unsupported_features(ldtk_project: LdtkJson.LdtkJSON):
-    ensure_identifier_style_lowercase(ldtk_project)
-    ensure_no_tileset_without_image(ldtk_project)
-    ensure_tile_dimensions_valid(ldtk_project)
-    ensure_no_parallax_scaling(ldtk_project)
-    ensure_no_unsupported_fields(ldtk_project)
-    ensure_no_different_opacities(ldtk_project)
-    ensure_no_unaligned_tiles(ldtk_project)
-    ensure_no_more_than_4_visible_layers(ldtk_project)
+    for ensure in (
+        ensure_identifier_style_lowercase,
+        ensure_no_tileset_without_image,
+        ensure_tile_dimensions_valid,
+        ensure_no_parallax_scaling,
+        ensure_no_unsupported_fields,
+        ensure_no_different_opacities,
+        ensure_no_unaligned_tiles,
+        ensure_no_more_than_4_visible_layers,
+    ):
+        with profiler.stage(ensure.__name__, "validate"):
+            ensure(ldtk_project)
+
+
+class TilesetBgItemJob(NamedTuple):
+    identifier: str
+    tile_size: int
+    used_tile_srcs: List[Point]
+    src_path: Optional[Path]
+    out_path: Path
+    palette_manual: bool
+    direct: bool
+    report_sizes: bool = False
+
+
+class TilesetBgItemResult(NamedTuple):
+    unique_tiles_count: Optional[int]
+    """Number of unique 8x8 tiles with the flipped duplicates reduced, or `None` if left to Butano's `bpp_4_auto`"""
+    file_paths: List[Path]
+    """Written in the worker process, so these are not tracked by themselves"""
+    sizes: Optional[TilesetSizes] = None
+    """Only if `TilesetBgItemJob.report_sizes`"""
 
 
 def generate_tilesets_bg_items(
@@ -286,15 +593,12 @@ def generate_tilesets_bg_items(
     ldtk_project_folder_path: Path,
     build_folder_path: Path,
     tileset_palette_manual: bool,
+    level_tilesets: bool,
+    direct_bg_items: bool,
+    jobs: int = 1,
+    size_report: Optional[SizeReport] = None,
 ):
-    TRANSPARENT_COLOR: Final[str] = "#00FF0000"
-
-    TILESET_BG_WIDTH: Final[int] = 256
-    # BG width is large at first to ensure the "dominant" transparent color
-    # ends up the first entry of the quantized palette.
-    TEMP_LARGE_WIDTH: Final[int] = TILESET_BG_WIDTH * 2 + 1
-    # BG height is always multiple of this.
-    TILESET_BG_HEIGHT_UNIT: Final[int] = 256
+    bg_item_jobs: List[TilesetBgItemJob] = []
 
     for tileset_def in ldtk_project.defs.tilesets:
         tiles_count = tileset_infos.get_tileset_used_tiles_count(tileset_def.uid)
@@ -314,99 +618,529 @@ def generate_tilesets_bg_items(
             if tileset_def.rel_path is not None
             else None
         )
-        tileset_out_path: Path = build_folder_path.joinpath(
-            f"graphics/ldtk_gen_priv_tileset_{tileset_def.identifier}"
-        )
-
-        tile_size = tileset_def.tile_grid_size
-        tiles_count_per_height_unit = 1024 / ((tile_size >> 3) ** 2)
-        tileset_bg_height = TILESET_BG_HEIGHT_UNIT * math.ceil(
-            (1 + tiles_count) / tiles_count_per_height_unit
-        )
 
         use_palette_manual = tileset_palette_manual and tileset_src_path is not None
-        bpp_mode = "bpp_4_manual" if use_palette_manual else "bpp_4_auto"
-
-        def paste_used_tiles_into(tileset_bg: Image.Image, tileset_src: Image.Image):
-            # Start from after the first transparent tile
-            paste_x, paste_y = ((tile_size >> 3) ** 2) * 8, 0
-            while paste_x >= TILESET_BG_WIDTH:
-                paste_x -= TILESET_BG_WIDTH
-                paste_y += 8
-
-            for i in range(tileset_infos.get_tileset_used_tiles_count(tileset_def.uid)):
-                src = tileset_infos.get_tileset_used_tile_src(tileset_def.uid, i)
-                for y in range(tile_size >> 3):
-                    for x in range(tile_size >> 3):
-                        sub_x = src.x + x * 8
-                        sub_y = src.y + y * 8
-                        tile = tileset_src.crop((sub_x, sub_y, sub_x + 8, sub_y + 8))
-                        tileset_bg.paste(tile, (paste_x, paste_y))
-
-                        paste_x += 8
-                        if paste_x >= TILESET_BG_WIDTH:
-                            assert paste_x == TILESET_BG_WIDTH
-                            paste_x = 0
-                            paste_y += 8
-
+        # Checked here, because exceptions with custom arguments can't be sent back from the worker processes
         if use_palette_manual:
             assert tileset_src_path is not None
             with Image.open(tileset_src_path) as tileset_src:
-                if tileset_src.mode != "P":
+                if tileset_src.mode != "P" or tileset_src.getpalette() is None:
                     raise TilesetPaletteManualRequiresIndexedImageException(
                         tileset_def.identifier, tileset_src.mode
                     )
 
-                palette = tileset_src.getpalette()
-                if palette is None:
-                    raise TilesetPaletteManualRequiresIndexedImageException(
-                        tileset_def.identifier, tileset_src.mode
-                    )
+        bg_item_jobs.append(
+            TilesetBgItemJob(
+                tileset_def.identifier,
+                tileset_def.tile_grid_size,
+                [
+                    tileset_infos.get_tileset_used_tile_src(tileset_def.uid, i)
+                    for i in range(tiles_count)
+                ],
+                tileset_src_path,
+                build_folder_path.joinpath(
+                    f"graphics/ldtk_gen_priv_tileset_{tileset_def.identifier}"
+                ),
+                use_palette_manual,
+                direct_bg_items,
+                size_report is not None,
+            )
+        )
+
+        if not level_tilesets:
+            continue
 
-                tileset_src.load()  # pyright: ignore[reportUnknownMemberType]
-
-                with Image.new(
-                    "P", (TILESET_BG_WIDTH, tileset_bg_height)
-                ) as tileset_bg:
-                    tileset_bg.putpalette(palette)
-                    tileset_bg.paste(0, (0, 0, TILESET_BG_WIDTH, tileset_bg_height))
-                    paste_used_tiles_into(tileset_bg, tileset_src)
-                    tileset_bg.save(tileset_out_path.with_suffix(".bmp"))
-
-        else:  # Use palette auto
-            with Image.new(
-                "RGBA", (TEMP_LARGE_WIDTH, tileset_bg_height), color=TRANSPARENT_COLOR
-            ) as tileset_bg:
-                if tileset_src_path is not None:
-                    with Image.open(tileset_src_path) as tileset_src:
-                        paste_used_tiles_into(tileset_bg, tileset_src)
-
-                # Start finalizing the tileset BG
-                tileset_bg = tileset_bg.quantize(256)
-                tileset_bg = tileset_bg.crop(
-                    (0, 0, TILESET_BG_WIDTH, tileset_bg_height)
+        # Subsets with only the tiles used in each level, in the same order as the whole tileset
+        for level in ldtk_project.levels:
+            level_used_tile_idxes = tileset_infos.get_level_tileset_used_tile_idxes(
+                level.identifier, tileset_def.uid
+            )
+            if level_used_tile_idxes is None:
+                continue
+
+            bg_item_jobs.append(
+                TilesetBgItemJob(
+                    tileset_def.identifier,
+                    tileset_def.tile_grid_size,
+                    [
+                        tileset_infos.get_tileset_used_tile_src(tileset_def.uid, i)
+                        for i in level_used_tile_idxes
+                    ],
+                    tileset_src_path,
+                    build_folder_path.joinpath(
+                        f"graphics/ldtk_gen_priv_tileset_{tileset_def.identifier}_level_{level.identifier}"
+                    ),
+                    use_palette_manual,
+                    direct_bg_items,
+                    size_report is not None,
                 )
+            )
+
+    if profiler.enabled:
+        results: List[TilesetBgItemResult] = []
+        for result, event in iter_parallel(profile_tileset_bg_item, bg_item_jobs, jobs):
+            results.append(result)
+            profiler.add_event(event)
+    else:
+        results = run_parallel(generate_tileset_bg_item, bg_item_jobs, jobs)
+
+    for result in results:
+        generated_file_paths.update(path.resolve() for path in result.file_paths)
+
+    for job, result in zip(bg_item_jobs, results):
+        if size_report is not None and result.sizes is not None:
+            size_report.add_tileset(job.out_path.name, result.sizes)
+
+        unique_tiles_count = result.unique_tiles_count
+        # With the `bpp_4_auto` fallback, Butano's 4bpp conversion might reduce the tiles further, so it's not checked
+        if unique_tiles_count is not None and unique_tiles_count > MAX_BG_TILES_COUNT:
+            raise TooManyUniqueTilesInTilesetException(
+                unique_tiles_count, job.identifier
+            )
+
+
+def profile_tileset_bg_item(
+    job: TilesetBgItemJob,
+) -> Tuple[TilesetBgItemResult, Dict[str, Any]]:
+    """`generate_tileset_bg_item()` recorded as a stage, which runs in a worker process"""
+    return run_profiled(job.out_path.name, "tileset", generate_tileset_bg_item, job)
+
+
+def split_tiles(image: Image.Image) -> List[bytes]:
+    """Splits an indexed image into 8x8 tiles of a byte per pixel, in the row-major order"""
+    buffer = image.tobytes()
+    tiles: List[bytes] = []
+    for tile_y in range(0, image.height, 8):
+        for tile_x in range(0, image.width, 8):
+            offset = tile_y * image.width + tile_x
+            tiles.append(
+                b"".join(
+                    buffer[row_offset : row_offset + 8]
+                    for row_offset in range(
+                        offset, offset + 8 * image.width, image.width
+                    )
+                )
+            )
+    return tiles
+
+
+def paste_used_tiles(
+    tileset_bg: Image.Image,
+    tileset_src: Image.Image,
+    used_tile_srcs: List[Point],
+    tile_size: int,
+):
+    """
+    Pastes the 8x8 tiles of the used tiles into the 256 pixels wide tile area of `tileset_bg`,
+    after the first transparent tile.
+
+    The pixel rows are gathered from the raw buffer of the `tileset_src` with slicing, and the tile area is pasted at once,
+    because a crop & paste per 8x8 tile is way too slow for big tilesets.
+    """
+    BG_WIDTH: Final[int] = 256
+    BG_TILES_PER_ROW: Final[int] = BG_WIDTH // 8
+
+    if not used_tile_srcs:
+        return
+
+    if tileset_src.mode != tileset_bg.mode:
+        tileset_src = tileset_src.convert(tileset_bg.mode)
+
+    # Out of bounds pixels are zero, same as cropping each 8x8 tile
+    src_width = max(tileset_src.width, max(src.x for src in used_tile_srcs) + tile_size)
+    src_height = max(
+        tileset_src.height, max(src.y for src in used_tile_srcs) + tile_size
+    )
+    if (src_width, src_height) != tileset_src.size:
+        padded_src = Image.new(tileset_src.mode, (src_width, src_height))
+        padded_src.paste(tileset_src, (0, 0))
+        tileset_src = padded_src
+
+    src_buffer = tileset_src.tobytes()
+    pixel_size = len(src_buffer) // (src_width * src_height)
+    src_stride = src_width * pixel_size
+    row_size = 8 * pixel_size
+
+    tiles_per_tile_row = tile_size >> 3
+    begin_tile_idx = tiles_per_tile_row**2
+    end_tile_idx = begin_tile_idx + len(used_tile_srcs) * tiles_per_tile_row**2
+    bg_tile_rows = -(-end_tile_idx // BG_TILES_PER_ROW)
+
+    # A row of 8x8 tiles in a used tile is contiguous in both the `src_buffer` and the tile area,
+    # so it's copied as a single run, unless it wraps around the BG tile row.
+    bg_tile_row_runs: List[List[Tuple[int, int]]] = [[] for _ in range(bg_tile_rows)]
+    """BG tile row -> List[(offset in the `src_buffer`, size)]"""
+    tile_idx = begin_tile_idx
+    for src in used_tile_srcs:
+        for sub_y in range(src.y, src.y + tile_size, 8):
+            offset = sub_y * src_stride + src.x * pixel_size
+            remaining = tiles_per_tile_row
+            while remaining > 0:
+                bg_tile_y, bg_tile_x = divmod(tile_idx, BG_TILES_PER_ROW)
+                count = min(remaining, BG_TILES_PER_ROW - bg_tile_x)
+                bg_tile_row_runs[bg_tile_y].append((offset, count * row_size))
+                offset += count * row_size
+                tile_idx += count
+                remaining -= count
+
+    # Starts from the current pixels, so that the transparent tile and the remainder are kept as is
+    tile_area = bytearray(tileset_bg.crop((0, 0, BG_WIDTH, bg_tile_rows * 8)).tobytes())
+    tile_area_stride = BG_WIDTH * pixel_size
+
+    for bg_tile_y, runs in enumerate(bg_tile_row_runs):
+        if not runs:
+            continue
+        row_begin = max(begin_tile_idx, bg_tile_y * BG_TILES_PER_ROW)
+        runs_size = sum(size for _, size in runs)
+
+        area_offset = (bg_tile_y * 8 * tile_area_stride) + (
+            row_begin % BG_TILES_PER_ROW
+        ) * row_size
+        for y_offset in range(0, 8 * src_stride, src_stride):
+            tile_area[area_offset : area_offset + runs_size] = b"".join(
+                [
+                    src_buffer[offset + y_offset : offset + y_offset + size]
+                    for offset, size in runs
+                ]
+            )
+            area_offset += tile_area_stride
+
+    tileset_bg.paste(
+        Image.frombytes(tileset_bg.mode, (BG_WIDTH, bg_tile_rows * 8), tile_area),
+        (0, 0),
+    )
+
+
+MAX_BG_TILES_COUNT: Final[int] = 1024
+"""Tile index of a regular BG map cell is 10 bits"""
+
+LOW_NIBBLE_TABLE: Final[bytes] = bytes(color_idx & 0xF for color_idx in range(256))
+
+
+def generate_tileset_bg_item(job: TilesetBgItemJob) -> TilesetBgItemResult:
+    """
+    Runs in a worker process, so it shouldn't touch anything other than the `job`.
+    """
+    TRANSPARENT_COLOR: Final[str] = "#00FF0000"
+
+    TILESET_BG_WIDTH: Final[int] = 256
+    # BG width is large at first to ensure the "dominant" transparent color
+    # ends up the first entry of the quantized palette.
+    TEMP_LARGE_WIDTH: Final[int] = TILESET_BG_WIDTH * 2 + 1
+    # BG height is always multiple of this.
+    TILESET_BG_HEIGHT_UNIT: Final[int] = 256
+
+    tile_size = job.tile_size
+    tiles_count = len(job.used_tile_srcs)
+    tiles_count_per_height_unit = 1024 / ((tile_size >> 3) ** 2)
+    tileset_bg_height = TILESET_BG_HEIGHT_UNIT * math.ceil(
+        (1 + tiles_count) / tiles_count_per_height_unit
+    )
+
+    if job.palette_manual:
+        assert job.src_path is not None
+        with Image.open(job.src_path) as tileset_src:
+            palette = tileset_src.getpalette()
+            assert tileset_src.mode == "P" and palette is not None
+
+            tileset_src.load()  # pyright: ignore[reportUnknownMemberType]
+
+            with Image.new("P", (TILESET_BG_WIDTH, tileset_bg_height)) as tileset_bg:
+                tileset_bg.putpalette(palette)
+                tileset_bg.paste(0, (0, 0, TILESET_BG_WIDTH, tileset_bg_height))
+                paste_used_tiles(tileset_bg, tileset_src, job.used_tile_srcs, tile_size)
+                return write_4bpp_tileset_bg_item(job, tileset_bg)
+
+    # Use palette auto
+    with Image.new(
+        "RGBA", (TEMP_LARGE_WIDTH, tileset_bg_height), color=TRANSPARENT_COLOR
+    ) as tileset_bg:
+        if job.src_path is not None:
+            with Image.open(job.src_path) as tileset_src:
+                paste_used_tiles(tileset_bg, tileset_src, job.used_tile_srcs, tile_size)
+
+        tileset_bg_rgba = tileset_bg.crop((0, 0, TILESET_BG_WIDTH, tileset_bg_height))
+        packed_tileset_bg = pack_tileset_palettes(tileset_bg_rgba)
+        if packed_tileset_bg is not None:
+            return write_4bpp_tileset_bg_item(job, packed_tileset_bg)
+
+        # Too many colors to pack, so leave the palette splitting to Butano
+        tileset_bg = tileset_bg.quantize(256)
+        tileset_bg = tileset_bg.crop((0, 0, TILESET_BG_WIDTH, tileset_bg_height))
+
+        # Sort the palette in RGB descending order (keeping transparent one)
+        tileset_palette = tileset_bg.palette
+        if tileset_palette:
+            palette_order = [
+                color[-1]
+                for color in sorted(tileset_palette.colors.items(), reverse=True)
+            ]
+            palette_order.remove(0)
+            palette_order.insert(0, 0)
+            tileset_bg = tileset_bg.remap_palette(palette_order)
+
+        # Every tile might be unique
+        tiles_count = (tileset_bg.width // 8) * (tileset_bg.height // 8)
+        return TilesetBgItemResult(
+            None,
+            write_tileset_bmp(job, tileset_bg, "bpp_4_auto"),
+            estimate_bmp_sizes(job, tileset_bg, tiles_count),
+        )
+
+
+def write_4bpp_tileset_bg_item(
+    job: TilesetBgItemJob, tileset_bg: Image.Image
+) -> TilesetBgItemResult:
+    """Writes the tileset BG, whose palette bank of each 8x8 tile is in the high nibble of its color indexes"""
+    if job.direct:
+        direct_bg_item = write_direct_bg_item(job, tileset_bg)
+        if direct_bg_item is not None:
+            return direct_bg_item
+
+    unique_tiles_count = count_unique_4bpp_tiles(tileset_bg)
+    return TilesetBgItemResult(
+        unique_tiles_count,
+        write_tileset_bmp(job, tileset_bg, "bpp_4_manual"),
+        estimate_bmp_sizes(job, tileset_bg, unique_tiles_count),
+    )
+
+
+def estimate_bmp_sizes(
+    job: TilesetBgItemJob, tileset_bg: Image.Image, tiles_count: int
+) -> Optional[TilesetSizes]:
+    """Sizes of the tileset BG that Butano's graphics tool would make from the BMP, with the colors written in it"""
+    if not job.report_sizes:
+        return None
+    map_cells_count = (tileset_bg.width // 8) * (tileset_bg.height // 8)
+    palette_colors_count = len(tileset_bg.getpalette() or []) // 3
+    return TilesetSizes(
+        tiles_count * 32, palette_colors_count * 2, map_cells_count * 2, True
+    )
 
-                # Sort the palette in RGB descending order (keeping transparent one)
-                tileset_palette = tileset_bg.palette
-                if tileset_palette:
-                    palette_order = [
-                        color[-1]
-                        for color in sorted(
-                            tileset_palette.colors.items(), reverse=True
-                        )
-                    ]
-                    palette_order.remove(0)
-                    palette_order.insert(0, 0)
-                    tileset_bg = tileset_bg.remap_palette(palette_order)
 
-                # Save it
-                tileset_bg.save(tileset_out_path.with_suffix(".bmp"))
+def write_tileset_bmp(
+    job: TilesetBgItemJob, tileset_bg: Image.Image, bpp_mode: str
+) -> List[Path]:
+    """Writes the BMP & JSON for Butano's graphics tool, and returns the paths of them"""
+    bmp_path = job.out_path.with_suffix(".bmp")
+    json_path = job.out_path.with_suffix(".json")
+
+    save_bmp_if_changed(tileset_bg, bmp_path)
+    # The map cells of the tileset reference the reduced tiles with the flip bits,
+    # and `ldtk::level_bgs_ptr` composes them with the flips of the tile instances.
+    write_if_changed(
+        json_path,
+        (
+            f'{{"type":"regular_bg","bpp_mode":"{bpp_mode}",'
+            '"repeated_tiles_reduction":true,"flipped_tiles_reduction":true}'
+        ).encode("utf-8"),
+    )
+    return [bmp_path, json_path]
+
+
+def write_direct_bg_item(
+    job: TilesetBgItemJob, tileset_bg: Image.Image
+) -> Optional[TilesetBgItemResult]:
+    """
+    Writes the 4bpp tiles, palette & map of the tileset BG as `.incbin` blobs,
+    and the `bn_regular_bg_items_*.h` header that Butano's graphics tool would've generated from the BMP.
+
+    Returns `None` if a tile uses more than one palette bank, which is left to Butano to report.
+    """
+    name = job.out_path.name
+    build_folder_path = job.out_path.parent.parent
+
+    tiles = split_tiles(tileset_bg)
+    palette_banks: List[int] = []
+    for tile in tiles:
+        tile_banks = {color_idx >> 4 for color_idx in tile if color_idx & 0xF}
+        if len(tile_banks) > 1:
+            return None
+        palette_banks.append(tile_banks.pop() if tile_banks else 0)
+
+    deduplicated = deduplicate_tiles(
+        [tile.translate(LOW_NIBBLE_TABLE) for tile in tiles]
+    )
+
+    # 4bpp tile has the left pixel in the low nibble
+    tiles_data = b"".join(
+        bytes(tile[x] | (tile[x + 1] << 4) for x in range(0, len(tile), 2))
+        for tile in deduplicated.tiles
+    )
+    map_data = struct.pack(
+        f"<{len(deduplicated.cells)}H",
+        *(
+            cell.tile_idx | (cell.x_flip << 10) | (cell.y_flip << 11) | (bank << 12)
+            for cell, bank in zip(deduplicated.cells, palette_banks)
+        ),
+    )
+    # Only the palette banks up to the last used one are loaded
+    colors_count = 16 * (1 + max(palette_banks))
+    palette = tileset_bg.getpalette() or []
+    palette += [0] * (colors_count * 3 - len(palette))
+    palette_data = struct.pack(
+        f"<{colors_count}H",
+        *(
+            (palette[i] >> 3)
+            | ((palette[i + 1] >> 3) << 5)
+            | ((palette[i + 2] >> 3) << 10)
+            for i in range(0, colors_count * 3, 3)
+        ),
+    )
+
+    priv_name = name.replace("ldtk_gen_priv_", "gen_priv_", 1)
+    # Assembly symbol, which doesn't clash with the user code
+    symbol = f"ldtk_{priv_name}"
+    file_paths = write_incbin_asm(
+        build_folder_path,
+        Path(f"{name}.s"),
+        [
+            IncbinBlob(f"{symbol}_tiles", tiles_data, 4),
+            IncbinBlob(f"{symbol}_palette", palette_data, 4),
+            IncbinBlob(f"{symbol}_map", map_data, 4),
+        ],
+    )
+
+    header_path = build_folder_path.joinpath(f"include/bn_regular_bg_items_{name}.h")
+    write_if_changed(
+        header_path,
+        f"""// Generated by `butano_ldtk.py`
+//
+// DO NOT edit this file directly - changes will be overwritten!
+
+#pragma once
+
+#include <bn_regular_bg_item.h>
+
+namespace ldtk::gen::priv
+{{
+
+extern const bn::tile {priv_name}_tiles[{len(deduplicated.tiles)}] asm("{symbol}_tiles");
+extern const bn::color {priv_name}_palette[{colors_count}] asm("{symbol}_palette");
+extern const bn::regular_bg_map_cell {priv_name}_map[{len(deduplicated.cells)}] asm("{symbol}_map");
+
+}} // namespace ldtk::gen::priv
+
+namespace bn::regular_bg_items
+{{
+
+constexpr inline regular_bg_item {name}(
+    regular_bg_tiles_item(span<const tile>(ldtk::gen::priv::{priv_name}_tiles), bpp_mode::BPP_4),
+    bg_palette_item(span<const color>(ldtk::gen::priv::{priv_name}_palette), bpp_mode::BPP_4),
+    regular_bg_map_item(ldtk::gen::priv::{priv_name}_map[0], size(32, {tileset_bg.height // 8})));
+
+}} // namespace bn::regular_bg_items
+""".encode("utf-8"),
+    )
+    file_paths.append(header_path)
+
+    sizes = None
+    if job.report_sizes:
+        sizes = TilesetSizes(
+            len(tiles_data),
+            len(palette_data),
+            len(map_data),
+            False,
+            lz77_compressed_size(tiles_data),
+        )
+
+    return TilesetBgItemResult(len(deduplicated.tiles), file_paths, sizes)
+
+
+def count_unique_4bpp_tiles(tileset_bg: Image.Image) -> int:
+    """Tiles only differing in the palette bank are the same 4bpp tile data, so they're reduced as well"""
+    return len(
+        deduplicate_tiles(
+            [tile.translate(LOW_NIBBLE_TABLE) for tile in split_tiles(tileset_bg)]
+        ).tiles
+    )
 
-        with tileset_out_path.with_suffix(".json").open(
-            "w", encoding="utf-8"
-        ) as tileset_json:
-            tileset_json.write(f'{{"type":"regular_bg","bpp_mode":"{bpp_mode}"}}')
+
+def pack_tileset_palettes(tileset_bg: Image.Image) -> Optional[Image.Image]:
+    """
+    Converts the RGBA tileset BG into an indexed image of 4bpp sub-palettes,
+    with each 8x8 tile using the palette bank its colors are packed in by `pack_sub_palettes()`.
+
+    Colors are reduced to the GBA's 15-bit colors first, and the pixels with alpha less than 128 are transparent.
+
+    Returns `None` if the colors can't be packed in 16 sub-palettes.
+    """
+    # Not a 15-bit color (the low 3 bits are set), so it can't be the same as any opaque color
+    TRANSPARENT_KEY: Final[Tuple[int, int, int]] = (0, 255, 0)
+    SUB_PALETTE_SIZE: Final[int] = 1 + MAX_SUB_PALETTE_COLORS_COUNT
+
+    red, green, blue, alpha = tileset_bg.convert("RGBA").split()
+    rgb555 = Image.merge(
+        "RGB", [band.point(lambda value: value & 0xF8) for band in (red, green, blue)]
+    )
+    keyed = Image.new("RGB", tileset_bg.size, TRANSPARENT_KEY)
+    keyed.paste(rgb555, mask=alpha.point(lambda value: 255 if value >= 128 else 0))
+
+    colors = keyed.getcolors(256)
+    if colors is None:
+        return None
+    # Color id 0 is transparent, and the rest are in RGB descending order
+    opaque_colors = sorted(
+        (color for _, color in colors if color != TRANSPARENT_KEY), reverse=True
+    )
+    if len(opaque_colors) > MAX_SUB_PALETTES_COUNT * MAX_SUB_PALETTE_COLORS_COUNT:
+        return None
+
+    # Exact colors are mapped to their ids, as the rest of the 256 entries are `TRANSPARENT_KEY`
+    ids_palette = Image.new("P", (1, 1))
+    ids_palette.putpalette(
+        bytes(
+            channel
+            for color in [TRANSPARENT_KEY, *opaque_colors]
+            + [TRANSPARENT_KEY] * (255 - len(opaque_colors))
+            for channel in color
+        )
+    )
+    ids = keyed.quantize(palette=ids_palette, dither=Image.Dither.NONE)
+    ids_buffer = ids.tobytes().translate(
+        bytes(
+            color_id if color_id <= len(opaque_colors) else 0 for color_id in range(256)
+        )
+    )
+    ids = Image.frombytes("P", ids.size, ids_buffer)
+
+    packed = pack_sub_palettes([frozenset(tile) - {0} for tile in split_tiles(ids)])
+    if packed is None:
+        return None
+
+    # Color id -> palette index, for each sub-palette
+    translate_tables: List[bytes] = []
+    palette = bytearray()
+    for bank, color_ids in enumerate(packed.palettes):
+        table = bytearray([bank * SUB_PALETTE_SIZE] * 256)
+        palette += bytes(TRANSPARENT_KEY)
+        for pos, color_id in enumerate(color_ids):
+            table[color_id] = bank * SUB_PALETTE_SIZE + 1 + pos
+            palette += bytes(opaque_colors[color_id - 1])
+        palette += bytes(3 * (MAX_SUB_PALETTE_COLORS_COUNT - len(color_ids)))
+        translate_tables.append(bytes(table))
+
+    width = ids.width
+    packed_buffer = bytearray(len(ids_buffer))
+    tile_idx = 0
+    for tile_y in range(0, ids.height, 8):
+        for tile_x in range(0, width, 8):
+            table = translate_tables[packed.tile_palette_idxes[tile_idx]]
+            tile_idx += 1
+            for offset in range(tile_y * width + tile_x, (tile_y + 8) * width, width):
+                packed_buffer[offset : offset + 8] = ids_buffer[
+                    offset : offset + 8
+                ].translate(table)
+
+    packed_tileset_bg = Image.frombytes("P", ids.size, bytes(packed_buffer))
+    packed_tileset_bg.putpalette(bytes(palette))
+    return packed_tileset_bg
+
+
+def save_bmp_if_changed(image: Image.Image, file_path: Path):
+    bmp = io.BytesIO()
+    image.save(bmp, format="BMP")
+    write_if_changed(file_path, bmp.getvalue())
 
 
 def generate_tileset_definitions(
@@ -414,11 +1148,14 @@ def generate_tileset_definitions(
     tileset_infos: TilesetInfos,
     ldtk_project: LdtkJson.LdtkJSON,
     build_folder_path: Path,
+    array_interner: ArrayInterner,
 ):
-    custom_datas_header = TilesetDefinitionsCustomDatasHeader()
+    custom_datas_header = TilesetDefinitionsCustomDatasHeader(array_interner)
     enum_tags_header = TilesetDefinitionsEnumTagsHeader()
-    enum_tag_tile_indexes_header = TilesetDefinitionsEnumTagTileIndexesHeader()
-    tags_header = TilesetDefinitionsTagsHeader()
+    enum_tag_tile_indexes_header = TilesetDefinitionsEnumTagTileIndexesHeader(
+        array_interner
+    )
+    tags_header = TilesetDefinitionsTagsHeader(array_interner)
     defs_header = TilesetDefinitionsHeader()
 
     for tileset_def in ldtk_project.defs.tilesets:
@@ -464,9 +1201,10 @@ def generate_layer_definitions(
 def generate_entity_definitions(
     ldtk_project: LdtkJson.LdtkJSON,
     build_folder_path: Path,
+    array_interner: ArrayInterner,
 ):
     entity_fields_header = EntityFieldDefinitionsHeader()
-    entity_tags_header = EntityDefinitionsTagsHeader()
+    entity_tags_header = EntityDefinitionsTagsHeader(array_interner)
     defs_header = EntityDefinitionsHeader()
 
     for entity_def in ldtk_project.defs.entities:
@@ -482,6 +1220,10 @@ def generate_entity_definitions(
 def generate_enum_headers(
     ldtk_project: LdtkJson.LdtkJSON,
     build_folder_path: Path,
+    compact: bool,
+    entity_tables: bool,
+    entity_tag_index: bool,
+    level_tilesets: bool,
 ):
     enums_header = EnumsHeader()
     idents_header = IdentsHeader()
@@ -527,6 +1269,19 @@ def generate_enum_headers(
         for tag in entity_def.tags:
             tags_header.add_tag(tag, "entity")
 
+    config_header = ConfigHeader(
+        compact,
+        {
+            **idents_header.value_counts(),
+            **iids_header.value_counts(),
+            **tags_header.value_counts(),
+        },
+        entity_tables,
+        entity_tag_index,
+        level_tilesets,
+    )
+
+    config_header.write(build_folder_path)
     enums_header.write(build_folder_path)
     idents_header.write(build_folder_path)
     iids_header.write(build_folder_path)
@@ -538,39 +1293,152 @@ def generate_definitions_headers(
     tileset_infos: TilesetInfos,
     ldtk_project: LdtkJson.LdtkJSON,
     build_folder_path: Path,
+    array_interner: ArrayInterner,
 ):
     generate_tileset_definitions(
-        enum_infos, tileset_infos, ldtk_project, build_folder_path
+        enum_infos, tileset_infos, ldtk_project, build_folder_path, array_interner
     )
     generate_level_field_definitions(ldtk_project, build_folder_path)
     generate_layer_definitions(ldtk_project, build_folder_path)
-    generate_entity_definitions(ldtk_project, build_folder_path)
+    generate_entity_definitions(ldtk_project, build_folder_path, array_interner)
 
     defs_header = DefinitionsHeader()
     defs_header.write(build_folder_path)
 
 
+class LayerCells(NamedTuple):
+    auto_layer_tiles: Optional[LayerAutoLayerTilesCellsHeader.CellsInfo]
+    grid_tiles: Optional[LayerGridTilesCellsHeader.CellsInfo]
+    int_grid: Optional[LayerIntGridCellsHeader.CellsInfo]
+
+
+worker_used_tile_idxes: Dict[int, Dict[Point, int]] = {}
+"""Tileset uid -> (Used tile src -> Used tile idx), set for each worker process"""
+worker_binary_cells: bool = False
+
+
+def init_level_cells_worker(
+    used_tile_idxes: Dict[int, Dict[Point, int]], binary_cells: bool
+):
+    global worker_used_tile_idxes, worker_binary_cells
+    worker_used_tile_idxes = used_tile_idxes
+    worker_binary_cells = binary_cells
+
+
+class LevelCellsJob(NamedTuple):
+    level: LdtkJson.Level
+    ext_level_path: Optional[Path]
+    """Reloaded to get the tiles left out by `load_slim_ldtk_level()`"""
+
+
+def parse_level_cells(job: LevelCellsJob) -> List[LayerCells]:
+    """Runs in a worker process; Parses & formats the cells of each layer, which dominates the per-level cost"""
+    level = job.level
+    full_level = (
+        level if job.ext_level_path is None else load_ldtk_level(job.ext_level_path)
+    )
+    assert level.layer_instances is not None
+    assert full_level.layer_instances is not None
+    result: List[LayerCells] = []
+    # Tiles are taken from the `full_level`, but the others from the `level`, which might be purged
+    for layer, full_layer in zip(level.layer_instances, full_level.layer_instances):
+        auto_layer_tiles = None
+        grid_tiles = None
+        int_grid = None
+
+        if layer.tileset_def_uid is not None:
+            used_tile_idxes = worker_used_tile_idxes[layer.tileset_def_uid]
+            if len(full_layer.auto_layer_tiles) != 0:
+                auto_layer_tiles = LayerAutoLayerTilesCellsHeader.parse_tiles(
+                    full_layer.auto_layer_tiles,
+                    level.identifier,
+                    layer,
+                    used_tile_idxes,
+                    worker_binary_cells,
+                )
+            if len(full_layer.grid_tiles) != 0:
+                grid_tiles = LayerGridTilesCellsHeader.parse_tiles(
+                    full_layer.grid_tiles,
+                    level.identifier,
+                    layer,
+                    used_tile_idxes,
+                    worker_binary_cells,
+                )
+
+        if any(layer.int_grid_csv):
+            int_grid = LayerIntGridCellsHeader.parse_cells(
+                level.identifier, layer, worker_binary_cells
+            )
+
+        result.append(LayerCells(auto_layer_tiles, grid_tiles, int_grid))
+    return result
+
+
 def generate_levels_headers(
     tileset_infos: TilesetInfos,
     ldtk_project: LdtkJson.LdtkJSON,
+    ldtk_project_folder_path: Path,
     build_folder_path: Path,
+    compact: bool,
+    entity_tables: bool,
+    entity_tag_index: bool,
+    binary_cells: bool,
+    extern_levels: bool,
+    level_tilesets: bool,
+    array_interner: ArrayInterner,
+    jobs: int = 1,
+    size_report: Optional[SizeReport] = None,
 ):
-    level_fields_header = LevelFieldInstancesHeader()
-    level_field_arrays_header = LevelFieldArraysHeader()
+    level_fields_header = LevelFieldInstancesHeader(compact, extern_levels)
+    level_field_arrays_header = LevelFieldArraysHeader(array_interner)
 
     auto_layer_tiles_header = LayerAutoLayerTilesHeader()
-    auto_layer_tiles_cells_header = LayerAutoLayerTilesCellsHeader()
+    auto_layer_tiles_cells_header = LayerAutoLayerTilesCellsHeader(
+        array_interner, binary_cells
+    )
     grid_tiles_header = LayerGridTilesHeader()
-    grid_tiles_cells_header = LayerGridTilesCellsHeader()
+    grid_tiles_cells_header = LayerGridTilesCellsHeader(array_interner, binary_cells)
     int_grids_header = LayerIntGridsHeader()
-    int_grid_cells_header = LayerIntGridCellsHeader()
-    layers_header = LevelLayerInstancesHeader()
-
-    entity_fields_header = LayerEntityFieldInstancesHeader()
-    entity_field_arrays_header = LayerEntityFieldArraysHeader()
-    entities_header = LayerEntityInstancesHeader()
-
-    levels_header = LevelsHeader(ldtk_project.levels)
+    int_grid_cells_header = LayerIntGridCellsHeader(array_interner, binary_cells)
+    entity_tag_index_header = LayerEntityTagIndexHeader(
+        ldtk_project.defs.entities, entity_tag_index, compact
+    )
+    layers_header = LevelLayerInstancesHeader(
+        compact,
+        entity_tables,
+        entity_tag_index_header.has_index(),
+        level_tilesets,
+        extern_levels,
+    )
+    tileset_subsets_header = LevelTilesetSubsetsHeader(array_interner, level_tilesets)
+
+    entity_fields_header = LayerEntityFieldInstancesHeader(compact, extern_levels)
+    entity_field_arrays_header = LayerEntityFieldArraysHeader(array_interner)
+    entities_header = LayerEntityInstancesHeader(compact, extern_levels)
+    entity_tables_header = LayerEntityTablesHeader(entity_tables, compact)
+
+    levels_header = LevelsHeader(ldtk_project.levels, compact, extern_levels)
+    stats_header = StatsHeader(ldtk_project.defs.layers, ldtk_project.defs.entities)
+
+    # The part header of a level includes the part headers of the same level it refers to
+    level_fields_header.add_level_dependency(level_field_arrays_header)
+    entity_fields_header.add_level_dependency(entity_field_arrays_header)
+    entities_header.add_level_dependency(entity_fields_header)
+    auto_layer_tiles_header.add_level_dependency(auto_layer_tiles_cells_header)
+    grid_tiles_header.add_level_dependency(grid_tiles_cells_header)
+    int_grids_header.add_level_dependency(int_grid_cells_header)
+    entity_tables_header.add_level_dependency(entities_header)
+    entity_tag_index_header.add_level_dependency(entities_header)
+    for layers_dependency in (
+        auto_layer_tiles_header,
+        grid_tiles_header,
+        int_grids_header,
+        entities_header,
+        entity_tables_header,
+        entity_tag_index_header,
+        tileset_subsets_header,
+    ):
+        layers_header.add_level_dependency(layers_dependency)
 
     entity_def_lut: Dict[int, LdtkJson.EntityDefinition] = {
         entity_def.uid: entity_def for entity_def in ldtk_project.defs.entities
@@ -601,8 +1469,37 @@ def generate_levels_headers(
         for layer in level.layer_instances:
             layer_iid_to_ident[layer.iid] = layer.identifier
 
-    for level in ldtk_project.levels:
+    # Parsed in parallel, but added to the headers in the level order below.
+    # Each level's cells are written & freed before moving on, so that only a few levels are in memory at once.
+    levels_cells: Iterator[List[LayerCells]] = iter_parallel(
+        parse_level_cells,
+        [
+            LevelCellsJob(
+                level,
+                (
+                    None
+                    if level.external_rel_path is None
+                    else ldtk_project_folder_path.joinpath(level.external_rel_path)
+                ),
+            )
+            for level in ldtk_project.levels
+        ],
+        jobs,
+        init_level_cells_worker,
+        (
+            {
+                tileset_def.uid: tileset_infos.get_tileset_used_tile_idxes(
+                    tileset_def.uid
+                )
+                for tileset_def in ldtk_project.defs.tilesets
+            },
+            binary_cells,
+        ),
+    )
+
+    for level, level_cells in zip(ldtk_project.levels, levels_cells):
         level_fields_header.add_fields(
+            level.identifier,
             level.identifier,
             level.field_instances,
             layer_iid_to_ident,
@@ -611,6 +1508,7 @@ def generate_levels_headers(
         )
         for field_idx, field in enumerate(level.field_instances):
             level_field_arrays_header.add_field_array(
+                level.identifier,
                 level.identifier,
                 field,
                 ldtk_project.defs.level_fields[field_idx],
@@ -620,35 +1518,39 @@ def generate_levels_headers(
 
         assert level.layer_instances is not None
         layers_header.add_layers(level.identifier, level.layer_instances, tileset_infos)
-        for layer in level.layer_instances:
+        tileset_subsets_header.add_level(
+            level.identifier, ldtk_project.defs.tilesets, tileset_infos
+        )
+        for layer, layer_cells in zip(level.layer_instances, level_cells):
             # Visible tiles
-            if layer.tileset_def_uid is not None:
-                if len(layer.auto_layer_tiles) != 0:
-                    auto_layer_tiles_header.add_grid(level.identifier, layer)
-                    auto_layer_tiles_cells_header.add_tiles(
-                        layer.auto_layer_tiles, level.identifier, layer, tileset_infos
-                    )
+            if layer_cells.auto_layer_tiles is not None:
+                auto_layer_tiles_header.add_grid(level.identifier, layer)
+                auto_layer_tiles_cells_header.add_cells_info(
+                    layer_cells.auto_layer_tiles
+                )
 
-                if len(layer.grid_tiles) != 0:
-                    grid_tiles_header.add_grid(level.identifier, layer)
-                    grid_tiles_cells_header.add_tiles(
-                        layer.grid_tiles, level.identifier, layer, tileset_infos
-                    )
+            if layer_cells.grid_tiles is not None:
+                grid_tiles_header.add_grid(level.identifier, layer)
+                grid_tiles_cells_header.add_cells_info(layer_cells.grid_tiles)
 
             # IntGrid
             if layer.int_grid_csv:
                 # if has non-zero cell
                 if any(layer.int_grid_csv):
                     int_grids_header.add_grid(level.identifier, layer, is_empty=False)
-                    int_grid_cells_header.add_cells(level.identifier, layer)
+                    assert layer_cells.int_grid is not None
+                    int_grid_cells_header.add_cells_info(layer_cells.int_grid)
                 # if all cells are zero
                 else:
                     int_grids_header.add_grid(level.identifier, layer, is_empty=True)
 
             # Entities
             entities_header.add_entities(level.identifier, layer, entity_idx_lut)
+            entity_tables_header.add_table(level.identifier, layer, entity_def_lut)
+            entity_tag_index_header.add_layer(level.identifier, layer, entity_def_lut)
             for entity in layer.entity_instances:
                 entity_fields_header.add_fields(
+                    level.identifier,
                     entity.iid.replace("-", "_"),
                     entity.field_instances,
                     layer_iid_to_ident,
@@ -661,6 +1563,7 @@ def generate_levels_headers(
                 )
                 for field_idx, field in enumerate(entity.field_instances):
                     entity_field_arrays_header.add_field_array(
+                        level.identifier,
                         entity.iid.replace("-", "_"),
                         field,
                         entity_def_lut[entity.def_uid].field_defs[field_idx],
@@ -668,6 +1571,65 @@ def generate_levels_headers(
                         level_iid_to_ident,
                     )
 
+        stats_header.add_level(
+            level,
+            [
+                (
+                    None
+                    if cells.auto_layer_tiles is None and cells.grid_tiles is None
+                    else (cells.auto_layer_tiles or cells.grid_tiles).bloated
+                )
+                for cells in level_cells
+            ],
+            [
+                cells.int_grid.cell_bits if cells.int_grid else None
+                for cells in level_cells
+            ],
+        )
+
+        if size_report is not None:
+            size_report.add_level(
+                level,
+                [
+                    (
+                        (
+                            cells.auto_layer_tiles.cells
+                            if cells.auto_layer_tiles
+                            else None
+                        ),
+                        cells.grid_tiles.cells if cells.grid_tiles else None,
+                        cells.int_grid.cells if cells.int_grid else None,
+                    )
+                    for cells in level_cells
+                ],
+                ldtk_project.defs.level_fields,
+                entity_def_lut,
+            )
+
+        # Flushed after the headers they depend on, so that the part headers to include are known
+        for level_header in (
+            level_field_arrays_header,
+            entity_field_arrays_header,
+            auto_layer_tiles_cells_header,
+            grid_tiles_cells_header,
+            int_grid_cells_header,
+            auto_layer_tiles_header,
+            grid_tiles_header,
+            int_grids_header,
+            tileset_subsets_header,
+            entity_fields_header,
+            entities_header,
+            entity_tables_header,
+            entity_tag_index_header,
+        ):
+            level_header.flush_level(level.identifier, build_folder_path)
+        if extern_levels:
+            LevelSource(level.identifier, [layers_header, level_fields_header]).write(
+                build_folder_path
+            )
+        layers_header.flush_level(level.identifier, build_folder_path)
+        level_fields_header.flush_level(level.identifier, build_folder_path)
+
     level_fields_header.write(build_folder_path)
     level_field_arrays_header.write(build_folder_path)
 
@@ -678,12 +1640,22 @@ def generate_levels_headers(
     int_grids_header.write(build_folder_path)
     int_grid_cells_header.write(build_folder_path)
     layers_header.write(build_folder_path)
+    tileset_subsets_header.write(build_folder_path)
 
     entity_fields_header.write(build_folder_path)
     entity_field_arrays_header.write(build_folder_path)
     entities_header.write(build_folder_path)
+    entity_tables_header.write(build_folder_path)
+    entity_tag_index_header.write(build_folder_path)
 
     levels_header.write(build_folder_path)
+    stats_header.write(build_folder_path)
+
+    if extern_levels:
+        levels_source = LevelsSource(
+            [level_fields_header, entity_fields_header, entities_header, levels_header]
+        )
+        levels_source.write(build_folder_path)
 
 
 def process_ldtk(
@@ -691,53 +1663,177 @@ def process_ldtk(
     build_folder_path: Path,
     tileset_palette_manual: bool = False,
     additional_ignore_tilesets: Optional[List[str]] = None,
+    compact: bool = False,
+    entity_tables: bool = False,
+    entity_tag_index: bool = False,
+    binary_cells: bool = False,
+    extern_levels: bool = False,
+    level_tilesets: bool = False,
+    direct_bg_items: bool = False,
+    jobs: Optional[int] = None,
+    profile_file_path: Optional[Path] = None,
+    size_report: bool = False,
 ) -> bool:
-    """Returns `False` if the process is skipped, because there's no modification"""
+    """
+    Returns `False` if the process is skipped, because there's no modification
+
+    `jobs` is the number of worker processes, which defaults to the CPU count.
+
+    `profile_file_path` is where to write the wall time & peak memory of each stage as a Chrome trace-event JSON;
+    If it's given, the process is never skipped.
+
+    `size_report` writes the estimated bytes of the generated data on the GBA to `ldtk_gen_size_report.txt` & `.json`.
+    """
+    if jobs is None:
+        jobs = default_jobs()
+
+    if profile_file_path is not None:
+        profiler.start()
+
     try:
         create_folder(build_folder_path.joinpath("include"))
         create_folder(build_folder_path.joinpath("graphics"))
         create_folder(build_folder_path.joinpath("src"))
 
-        ldtk_project = load_ldtk_project_if_process_required(
-            ldtk_project_file_path, build_folder_path
+        input_hashes = hash_inputs(
+            ldtk_project_file_path,
+            {
+                "tileset_palette_manual": tileset_palette_manual,
+                "additional_ignore_tilesets": additional_ignore_tilesets,
+                "compact": compact,
+                "entity_tables": entity_tables,
+                "entity_tag_index": entity_tag_index,
+                "binary_cells": binary_cells,
+                "extern_levels": extern_levels,
+                "level_tilesets": level_tilesets,
+                "direct_bg_items": direct_bg_items,
+                "size_report": size_report,
+            },
         )
-        if ldtk_project is None:
+        if profile_file_path is None and not is_process_required(
+            build_folder_path, input_hashes
+        ):
             return False
 
         print("Start converting LDtk project...")
 
-        purge_ignore_tilesets(ldtk_project, additional_ignore_tilesets)
+        # Invalidated until this conversion succeeds
+        build_folder_path.joinpath(MANIFEST_FILE_NAME).unlink(missing_ok=True)
+        generated_file_paths.clear()
+
+        with profiler.stage("load_ldtk_project"):
+            ldtk_project = load_ldtk_project(ldtk_project_file_path, jobs)
+        with profiler.stage("purge_ignore_tilesets", "validate"):
+            purge_ignore_tilesets(ldtk_project, additional_ignore_tilesets)
 
-        remove_built_files(build_folder_path)
         ensure_no_unsupported_features(ldtk_project)
+        if compact:
+            with profiler.stage("ensure_compact_representable", "validate"):
+                ensure_compact_representable(ldtk_project)
+        if entity_tables:
+            with profiler.stage("ensure_entity_tables_representable", "validate"):
+                ensure_entity_tables_representable(ldtk_project)
 
         ldtk_project_folder_path: Path = ldtk_project_file_path.parent
-
-        enum_infos = EnumInfos(ldtk_project)
-        tileset_infos = TilesetInfos(ldtk_project)
-        generate_tilesets_bg_items(
-            tileset_infos,
-            ldtk_project,
-            ldtk_project_folder_path,
-            build_folder_path,
-            tileset_palette_manual,
+        # The tag index is not generated without any entity tag, like `LayerEntityTagIndexHeader.has_index()`
+        has_entity_tag_index = entity_tag_index and any(
+            len(entity_def.tags) != 0 for entity_def in ldtk_project.defs.entities
         )
-        generate_definitions_headers(
-            enum_infos, tileset_infos, ldtk_project, build_folder_path
+        report = (
+            SizeReport(
+                compact,
+                layer_optional_pointers=int(entity_tables)
+                + int(has_entity_tag_index)
+                + int(level_tilesets),
+            )
+            if size_report
+            else None
         )
-        generate_levels_headers(tileset_infos, ldtk_project, build_folder_path)
+
+        with profiler.stage("EnumInfos"):
+            enum_infos = EnumInfos(ldtk_project)
+        with profiler.stage("TilesetInfos"):
+            tileset_infos = TilesetInfos(ldtk_project)
+        with profiler.stage("generate_tilesets_bg_items"):
+            generate_tilesets_bg_items(
+                tileset_infos,
+                ldtk_project,
+                ldtk_project_folder_path,
+                build_folder_path,
+                tileset_palette_manual,
+                level_tilesets,
+                direct_bg_items,
+                jobs,
+                report,
+            )
+        array_interner = ArrayInterner()
+        with profiler.stage("generate_definitions_headers"):
+            generate_definitions_headers(
+                enum_infos,
+                tileset_infos,
+                ldtk_project,
+                build_folder_path,
+                array_interner,
+            )
+        with profiler.stage("generate_levels_headers"):
+            generate_levels_headers(
+                tileset_infos,
+                ldtk_project,
+                ldtk_project_folder_path,
+                build_folder_path,
+                compact,
+                entity_tables,
+                entity_tag_index,
+                binary_cells,
+                extern_levels,
+                level_tilesets,
+                array_interner,
+                jobs,
+                report,
+            )
 
         # This one should be last, because functions above might sort identifiers
-        generate_enum_headers(ldtk_project, build_folder_path)
+        with profiler.stage("generate_enum_headers"):
+            generate_enum_headers(
+                ldtk_project,
+                build_folder_path,
+                compact,
+                entity_tables,
+                entity_tag_index,
+                level_tilesets,
+            )
 
         # Finally, generate the main project header
         project_header = ProjectHeader(ldtk_project)
         project_header.write(build_folder_path)
 
+        if array_interner.deduplicated_arrays != 0:
+            print(
+                f"Deduplicated {array_interner.deduplicated_arrays} identical arrays "
+                f"(~{array_interner.deduplicated_bytes} bytes saved)"
+            )
+
+        # Only the changed files are rewritten above, so the unchanged ones keep their modified times
+        remove_stale_built_files(build_folder_path)
+        write_manifest(build_folder_path, input_hashes)
+
+        if report is not None:
+            report.deduplicated_bytes = array_interner.deduplicated_bytes
+            report.write(build_folder_path)
+
+        if profile_file_path is not None:
+            profiler.write(profile_file_path)
+            print(f'Wrote the conversion profile to "{profile_file_path}"')
+
         return True
     except:
-        remove_built_files(build_folder_path)
+        # Only the manifest is removed, so that the next conversion reconverts,
+        # but still keeps the unchanged built files untouched (e.g. after saving a broken level by mistake).
+        build_folder_path.joinpath(MANIFEST_FILE_NAME).unlink(missing_ok=True)
         raise
+    finally:
+        if profiler.enabled:
+            profiler.stop()
 
 
 if __name__ == "__main__":
@@ -765,6 +1861,93 @@ if __name__ == "__main__":
             "Example: --ignore-tilesets ldtk_only debug_tiles"
         ),
     )
+    parser.add_argument(
+        "--compact",
+        action="store_true",
+        help=(
+            "Generate a compact object graph to save ROM; "
+            "Instances are pooled and referenced by 16-bit offsets, and idents use the smallest underlying type."
+        ),
+    )
+    parser.add_argument(
+        "--entity-tables",
+        action="store_true",
+        help=(
+            "Also generate structure-of-arrays entity tables per layer instance, "
+            "accessible via `ldtk::layer::entity_table()`."
+        ),
+    )
+    parser.add_argument(
+        "--entity-tag-index",
+        action="store_true",
+        help=(
+            "Also generate per-tag entity indexes per layer instance, "
+            "accessible via `ldtk::layer::tagged_entities()`."
+        ),
+    )
+    parser.add_argument(
+        "--binary-cells",
+        action="store_true",
+        help=(
+            "Write the layer cells as binary blobs assembled with `.incbin`, referenced by `extern` arrays; "
+            "Compile time doesn't depend on the level size anymore, but the cells can't be read in constexpr."
+        ),
+    )
+    parser.add_argument(
+        "--extern-levels",
+        action="store_true",
+        help=(
+            "Define the levels in a generated source file, and only declare them as `extern` in the headers; "
+            "Including `ldtk_gen_project.h` gets cheaper, but the level contents can't be read in constexpr."
+        ),
+    )
+    parser.add_argument(
+        "--level-tilesets",
+        action="store_true",
+        help=(
+            "Also generate a tileset BG per level with only the tiles used in the level, "
+            "so that the level BGs upload less tiles to VRAM; Accessible via `ldtk::layer::tileset_subset()`."
+        ),
+    )
+    parser.add_argument(
+        "--direct-bg-items",
+        action="store_true",
+        help=(
+            "Write the 4bpp tiles, palette & map of the tileset BGs and their `bn_regular_bg_items_*.h` headers directly, "
+            "instead of BMPs converted by Butano's graphics tool; "
+            "Tilesets with too many colors for 16 palette banks still fall back to BMPs."
+        ),
+    )
+    parser.add_argument(
+        "--jobs",
+        type=int,
+        default=default_jobs(),
+        help=(
+            "Number of worker processes to load levels, process tilesets and parse level cells in parallel "
+            "(default: CPU count); The output is the same regardless of it."
+        ),
+    )
+
+    parser.add_argument(
+        "--size-report",
+        action="store_true",
+        help=(
+            "Write the estimated bytes of the generated data on the GBA per tileset, level & layer, "
+            "and what `--compact` & LZ77 compression would save, to `ldtk_gen_size_report.txt` & `.json` "
+            "in the build folder."
+        ),
+    )
+    parser.add_argument(
+        "--profile",
+        nargs="?",
+        const=PROFILE_FILE_NAME,
+        metavar="PATH",
+        help=(
+            "Write the wall time & peak memory of each conversion stage as a Chrome trace-event JSON, "
+            f"relative to the build folder (default: {PROFILE_FILE_NAME}); "
+            "Open it in `chrome://tracing` or https://ui.perfetto.dev. It always converts, and runs a few times slower."
+        ),
+    )
 
     try:
         args = parser.parse_args()
@@ -776,6 +1959,18 @@ if __name__ == "__main__":
             build_folder_path,
             tileset_palette_manual=args.tileset_palette_manual,
             additional_ignore_tilesets=args.ignore_tilesets,
+            compact=args.compact,
+            entity_tables=args.entity_tables,
+            entity_tag_index=args.entity_tag_index,
+            binary_cells=args.binary_cells,
+            extern_levels=args.extern_levels,
+            level_tilesets=args.level_tilesets,
+            direct_bg_items=args.direct_bg_items,
+            jobs=args.jobs,
+            size_report=args.size_report,
+            profile_file_path=(
+                build_folder_path.joinpath(args.profile) if args.profile else None
+            ),
         ):
             print(
                 f'Successfully converted LDtk project "{ldtk_project_file_path}" to "{build_folder_path}"'
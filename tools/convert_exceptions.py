@@ -79,6 +79,15 @@ class TooManyUsedTilesInTilesetException(Exception):
         self.tileset = tileset
 
 
+class TooManyUniqueTilesInTilesetException(Exception):
+    def __init__(self, unique_tiles_count: int, tileset: str):
+        super().__init__(
+            f'Too many unique 8x8 tiles for a BG - {unique_tiles_count}, while the maximum is 1024 (found in Tileset "{tileset}")'
+        )
+        self.unique_tiles_count = unique_tiles_count
+        self.tileset = tileset
+
+
 class NoLayerException(Exception):
     def __init__(self):
         super().__init__("No layer exists")
@@ -112,3 +121,34 @@ class TilesetPaletteManualRequiresIndexedImageException(Exception):
         )
         self.tileset = tileset
         self.mode = mode
+
+
+class ValueOutOfRangeException(Exception):
+    def __init__(
+        self,
+        name: str,
+        value: int,
+        min_value: int,
+        max_value: int,
+        option: str,
+        source: str,
+    ):
+        super().__init__(
+            f"{name} {value} is out of range [{min_value}, {max_value}] "
+            f"when using {option} (found in {source})"
+        )
+        self.name = name
+        self.value = value
+        self.min_value = min_value
+        self.max_value = max_value
+        self.option = option
+        self.source = source
+
+
+class TooManyTagsException(Exception):
+    def __init__(self, tags_count: int, context: str):
+        super().__init__(
+            f"More than 64 {context} tags are not supported - {tags_count}"
+        )
+        self.tags_count = tags_count
+        self.context = context
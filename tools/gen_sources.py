@@ -3,12 +3,95 @@
 
 from models import *
 from convert_exceptions import *
+from profiler import profiler
 from abc import ABCMeta, abstractmethod
-from io import TextIOWrapper
-from datetime import datetime
+from array import array
+from io import StringIO, TextIOWrapper
+import hashlib
+import os
+import sys
 from pathlib import Path
 from enum import Enum
-from typing import Dict, DefaultDict, List, NamedTuple, Tuple, Optional, Generator
+from typing import (
+    Any,
+    Dict,
+    DefaultDict,
+    Final,
+    List,
+    NamedTuple,
+    Sequence,
+    Tuple,
+    Optional,
+    Generator,
+    Set,
+)
+
+generated_file_paths: Set[Path] = set()
+"""Every file generated in this conversion, so that the stale ones can be removed afterwards"""
+
+
+def write_if_changed(file_path: Path, contents: bytes):
+    """
+    Writes the file only if its bytes are changed, so that its modified time is kept for the build system.
+    """
+    generated_file_paths.add(file_path.resolve())
+    if file_path.exists() and file_path.read_bytes() == contents:
+        return
+
+    # Replaced at once, so that an interrupted conversion never leaves a half-written file
+    temp_file_path = file_path.with_name(file_path.name + ".tmp")
+    temp_file_path.write_bytes(contents)
+    os.replace(temp_file_path, file_path)
+
+
+INCBIN_FOLDER: Final[Path] = Path("incbin")
+
+
+class IncbinBlob(NamedTuple):
+    symbol: str
+    data: bytes
+    alignment: int
+
+
+def write_incbin_asm(
+    build_folder_path: Path, asm_file_path: Path, blobs: List[IncbinBlob]
+) -> List[Path]:
+    """
+    Writes the blobs into `incbin/`, and the assembly source in `src/` that `.incbin`s them as global symbols.
+    Returns the paths of the written files.
+    """
+    blob_folder_path = build_folder_path.joinpath(INCBIN_FOLDER)
+    blob_folder_path.mkdir(parents=True, exist_ok=True)
+    file_paths: List[Path] = []
+
+    asm = StringIO()
+    # C-style comments, so that it also assembles on the host (`host/`), where `@` doesn't start a comment.
+    asm.write("/*\n")
+    asm.write(" * Generated by `butano_ldtk.py`\n")
+    asm.write(" *\n")
+    asm.write(" * DO NOT edit this file directly - changes will be overwritten!\n")
+    asm.write(" */\n\n")
+    asm.write("    .section .rodata\n\n")
+    for blob in blobs:
+        blob_path = blob_folder_path.joinpath(f"{blob.symbol}.bin")
+        write_if_changed(blob_path, blob.data)
+        file_paths.append(blob_path)
+
+        # `.incbin` files are not tracked by the dependency files,
+        # so the hash makes this source change whenever the blob is changed.
+        asm.write(f"    /* sha1: {hashlib.sha1(blob.data).hexdigest()} */\n")
+        asm.write(f"    .balign {blob.alignment}\n")
+        asm.write(f"    .global {blob.symbol}\n")
+        asm.write(f"    .type {blob.symbol}, %object\n")
+        asm.write(f"    .size {blob.symbol}, {len(blob.data)}\n")
+        asm.write(f"{blob.symbol}:\n")
+        asm.write(f'    .incbin "{blob_path.resolve().as_posix()}"\n\n')
+
+    asm_path = build_folder_path.joinpath("src").joinpath(asm_file_path)
+    write_if_changed(asm_path, asm.getvalue().encode("utf-8"))
+    file_paths.append(asm_path)
+
+    return file_paths
 
 
 class GenSource(metaclass=ABCMeta):
@@ -30,16 +113,15 @@ class GenSource(metaclass=ABCMeta):
         source_path: Path = build_folder_path.joinpath(self._sub_folder()).joinpath(
             self.base_file_path()
         )
-        try:
-            with source_path.open("w", encoding="utf-8") as source:
-                self.__write_heading(source)
-                self.__write_includes(source)
-                self.__write_namespace_open(source)
-                self._write_contents(source)
-                self.__write_namespace_close(source)
-        except:
-            source_path.unlink(missing_ok=True)
-            raise
+        with profiler.stage(source_path.name, "write"):
+            # Rendered in memory first, so that an unchanged file is not touched
+            source = StringIO()
+            self.__write_heading(source)
+            self.__write_includes(source)
+            self.__write_namespace_open(source)
+            self._write_contents(source)
+            self.__write_namespace_close(source)
+            write_if_changed(source_path, source.getvalue().encode("utf-8"))
 
     @abstractmethod
     def _write_contents(self, source: TextIOWrapper):
@@ -58,7 +140,8 @@ class GenSource(metaclass=ABCMeta):
         pass
 
     def __write_heading(self, source: TextIOWrapper):
-        source.write(f"// Generated by `butano_ldtk.py` in {datetime.now()}\n")
+        # No timestamp here, as it would change the bytes of every file on each conversion
+        source.write("// Generated by `butano_ldtk.py`\n")
         source.write("//\n")
         source.write(
             "// DO NOT edit this file directly - changes will be overwritten!\n\n"
@@ -107,6 +190,415 @@ class GenPrivHeader(GenHeader):
         return "::gen::priv"
 
 
+class LevelPartHeader(GenPrivHeader):
+    """Header of the pre-rendered contents of a single level, written by the `LevelSplitHeader`"""
+
+    def __init__(self, file_path: Path, contents: str):
+        super().__init__()
+        self.file_path = file_path
+        self.contents = contents
+
+    def base_file_path(
+        self,
+    ) -> Path:  # pyright: ignore[reportIncompatibleMethodOverride]
+        return self.file_path
+
+    def _write_contents(self, source: TextIOWrapper):
+        source.write(self.contents)
+
+
+class LevelSplitHeader(GenPrivHeader):
+    """
+    Writes the contents of each level into its own part header, and includes them all.
+
+    So, editing a level only rewrites the part headers of that level.
+
+    With `extern_definitions`, the contents are defined in the `LevelSource` of each level instead,
+    and this header only has the `extern` declarations of them.
+    """
+
+    def __init__(self, extern_definitions: bool = False):
+        super().__init__()
+        self.extern_definitions = extern_definitions
+
+        self.part_includes: List[Tuple[str, bool]] = []
+        """Includes for every level part header"""
+        self.level_dependencies: List[LevelSplitHeader] = []
+        """Headers whose contents of the same level are referenced by the contents of a level"""
+        self.part_file_paths: Dict[str, Path] = {}
+        """Level identifier -> Its written part header"""
+        self.declarations = StringIO()
+        """`extern` declarations of the flushed levels, with `extern_definitions`"""
+        self.array_levels: Dict[str, str] = {}
+        """Written array name -> Level identifier, to include its part header from the levels aliasing it"""
+
+    def add_part_include(
+        self, include_header_filename: str, is_system_header: bool = False
+    ):
+        self.part_includes.append((include_header_filename, is_system_header))
+
+    def add_level_dependency(self, header: "LevelSplitHeader"):
+        """Includes the part header of the same level, so it must be flushed before this one"""
+        self.level_dependencies.append(header)
+
+    def splits_levels(self) -> bool:
+        """`False` if the contents are not split, but written in this header (e.g. a project-wide pool)"""
+        return True
+
+    def dependency_includes(self, level_ident: str) -> List[str]:
+        """Headers of the `level_dependencies` that the contents of the level need"""
+        result: List[str] = []
+        for dependency in self.level_dependencies:
+            if not dependency.splits_levels():
+                result.append(str(dependency.base_file_path()))
+            elif (part_path := dependency.part_file_paths.get(level_ident)) is not None:
+                result.append(str(part_path))
+        return result
+
+    def level_part_file_path(self, level_ident: str) -> Path:
+        return Path(
+            str(self.base_file_path()).replace(
+                "ldtk_gen_priv_", f"ldtk_gen_priv_level_{level_ident}_", 1
+            )
+        )
+
+    def flush_level(self, level_ident: str, build_folder_path: Path):
+        """Writes the part header of the level right away, and frees its contents.
+
+        Levels must be flushed in the order they're added, as the part headers are included in that order.
+        With `extern_definitions`, the `LevelSource` of the level must be written before this.
+        """
+        if level_ident not in self._level_idents():
+            return
+
+        if self.extern_definitions:
+            self._write_level_declarations(level_ident, self.declarations)
+            self._free_level(level_ident)
+            return
+
+        contents = StringIO()
+        level_includes: List[Path] = []
+        self._write_level_contents(level_ident, contents, level_includes)
+
+        part = LevelPartHeader(
+            self.level_part_file_path(level_ident), contents.getvalue()
+        )
+        for include_header_filename, is_system_header in self.part_includes:
+            part.add_include(include_header_filename, is_system_header)
+        for dependency_include in self.dependency_includes(level_ident):
+            part.add_include(dependency_include)
+        for level_include in level_includes:
+            part.add_include(str(level_include))
+        part.write(build_folder_path)
+        self._write_level_blobs(level_ident, build_folder_path)
+
+        self.part_file_paths[level_ident] = part.base_file_path()
+        self.add_include(str(part.base_file_path()))
+        self._free_level(level_ident)
+
+    def write(self, build_folder_path: Path):
+        for level_ident in self._level_idents():
+            self.flush_level(level_ident, build_folder_path)
+
+        super().write(build_folder_path)
+
+    def _intern(
+        self,
+        interner: "ArrayInterner",
+        level_ident: str,
+        level_includes: List[Path],
+        element_type: str,
+        elements: Sequence[Any],
+        name: str,
+    ) -> Optional[str]:
+        """`ArrayInterner.intern()`, which also adds the part header of the level that has the interned array"""
+        interned = interner.intern(
+            str(self.base_file_path()), element_type, elements, name
+        )
+        if interned is None:
+            self.array_levels[name] = level_ident
+            return None
+
+        interned_level = self.array_levels[interned]
+        if interned_level != level_ident:
+            level_includes.append(self.level_part_file_path(interned_level))
+        return interned
+
+    def _write_level_blobs(self, level_ident: str, build_folder_path: Path):
+        """Writes the binary blobs of the level, if there's any"""
+        pass
+
+    def _write_contents(self, source: TextIOWrapper):
+        # Only includes the level part headers, or declares the definitions of the `LevelSource`s
+        source.write(self.declarations.getvalue())
+
+    def _write_level_declarations(self, level_ident: str, source: TextIOWrapper):
+        """Writes the `extern` declarations of the contents of the level, with `extern_definitions`"""
+        raise NotImplementedError(type(self).__name__)
+
+    def _write_level_definitions(
+        self, level_ident: str, source: TextIOWrapper, specifier: str
+    ):
+        """Writes the definitions of the `extern` declarations of the level into its `LevelSource`"""
+        raise NotImplementedError(type(self).__name__)
+
+    @abstractmethod
+    def _level_idents(self) -> List[str]:
+        """Levels with any contents not flushed yet, in the order of the level part headers"""
+        pass
+
+    @abstractmethod
+    def _free_level(self, level_ident: str):
+        """Frees the contents of the flushed level"""
+        pass
+
+    @abstractmethod
+    def _write_level_contents(
+        self, level_ident: str, source: TextIOWrapper, level_includes: List[Path]
+    ):
+        """Writes the contents of the level; Adds part headers of other levels to `level_includes`, if needed."""
+        pass
+
+
+class ArrayInterner:
+    """Content-hash interning of the generated arrays.
+
+    Only the first one of the identical arrays is emitted, and the others become references to it.
+    """
+
+    ELEMENT_SIZES: Final[Dict[str, int]] = {
+        "std::uint8_t": 1,
+        "std::int8_t": 1,
+        "std::uint16_t": 2,
+        "std::int16_t": 2,
+        "std::uint32_t": 4,
+        "std::int32_t": 4,
+        "std::uint64_t": 8,
+        "std::int64_t": 8,
+        "bool": 1,
+        "bn::fixed": 4,
+        "bn::color": 2,
+        "bn::point": 8,
+        "bn::string_view": 8,
+        "entity_ref": 12,
+        "tile_index": 2,
+        "tileset_custom_data": 12,
+    }
+    """Estimated element sizes for the report; Unlisted ones are assumed to be 4 bytes"""
+
+    class Entry(NamedTuple):
+        name: str
+        elements: Optional[Sequence[Any]]
+        """`None` for an `array`, whose contents aren't kept, so that the cells of the written levels can be freed"""
+
+    def __init__(self):
+        self.entries: Dict[Tuple[str, str, bytes], ArrayInterner.Entry] = {}
+        """(scope, element type, content hash) -> Entry"""
+
+        self.deduplicated_arrays = 0
+        self.deduplicated_bytes = 0
+
+    def intern(
+        self, scope: str, element_type: str, elements: Sequence[Any], name: str
+    ) -> Optional[str]:
+        """Returns the name of the identical array interned before in the same scope,
+        or `None` if `name` is the first one with its contents."""
+        if isinstance(elements, array):
+            # Hashes the exact contents with a wide digest instead of keeping them
+            digest = hashlib.sha256(
+                elements.typecode.encode("ascii") + elements.tobytes()
+            ).digest()
+            kept_elements = None
+        else:
+            digest = hashlib.sha1(
+                "\0".join(str(elem) for elem in elements).encode("utf-8")
+            ).digest()
+            kept_elements = elements
+        key = (scope, element_type, digest)
+
+        entry = self.entries.get(key)
+        if entry is None:
+            self.entries[key] = ArrayInterner.Entry(name, kept_elements)
+            return None
+        # Hash collision is practically impossible, but never alias different contents
+        if entry.elements is not None and list(entry.elements) != list(elements):
+            return None
+
+        self.deduplicated_arrays += 1
+        self.deduplicated_bytes += len(elements) * ArrayInterner.ELEMENT_SIZES.get(
+            element_type, 4
+        )
+        return entry.name
+
+    @staticmethod
+    def write_alias(source: TextIOWrapper, name: str, interned_name: str):
+        source.write(f"inline constexpr const auto& {name} = {interned_name};\n\n")
+
+
+class LayerCellsHeader(LevelSplitHeader):
+    """
+    Base of the layer cells headers, which are the largest part of the generated code.
+
+    With `binary`, the cells are written as raw binary blobs assembled with `.incbin`,
+    and the headers only have `extern` declarations of them.
+    So, the compile time & memory of a TU don't depend on the level size, but the cells can't be read in constexpr.
+    """
+
+    def __init__(self, interner: Optional[ArrayInterner], binary: bool):
+        super().__init__()
+        self.add_part_include("cstdint", is_system_header=True)
+
+        self.interner = interner if interner is not None else ArrayInterner()
+        self.binary = binary
+
+        self.blobs: DefaultDict[str, List[IncbinBlob]] = DefaultDict(list)
+        """Level identifier -> Blobs of it"""
+
+    def _write_cells(
+        self,
+        level_ident: str,
+        source: TextIOWrapper,
+        level_includes: List[Path],
+        element_type: str,
+        cells_name: str,
+        cells: "array[int]",
+        body: str,
+    ):
+        interned = self._intern(
+            self.interner, level_ident, level_includes, element_type, cells, cells_name
+        )
+        if interned is not None:
+            ArrayInterner.write_alias(source, cells_name, interned)
+            return
+
+        if not self.binary:
+            source.write(f"inline constexpr const {element_type} {cells_name}[] {{")
+            source.write(body)
+            source.write("\n};\n\n")
+            return
+
+        element_size = ArrayInterner.ELEMENT_SIZES[element_type]
+        assert cells.itemsize == element_size
+        if sys.byteorder != "little":
+            cells = array(cells.typecode, cells)
+            cells.byteswap()
+        # Assembly symbol, which doesn't clash with the user code
+        symbol = f"ldtk_{cells_name}"
+        self.blobs[level_ident].append(
+            IncbinBlob(symbol, cells.tobytes(), element_size)
+        )
+        source.write(
+            f'extern const {element_type} {cells_name}[{len(cells)}] asm("{symbol}");\n\n'
+        )
+
+    def _write_level_blobs(self, level_ident: str, build_folder_path: Path):
+        blobs = self.blobs.get(level_ident)
+        if not blobs:
+            return
+
+        write_incbin_asm(
+            build_folder_path,
+            self.level_part_file_path(level_ident).with_suffix(".s"),
+            blobs,
+        )
+
+    def _free_level(self, level_ident: str):
+        self.blobs.pop(level_ident, None)
+
+
+class ConfigHeader(GenPrivHeader):
+    IDENT_ENUMS: Final[List[str]] = [
+        "tileset_ident",
+        "level_ident",
+        "level_field_ident",
+        "layer_ident",
+        "layer_int_grid_value_ident",
+        "layer_int_grid_value_group_ident",
+        "entity_ident",
+        "entity_field_ident",
+    ]
+    IID_ENUMS: Final[List[str]] = [
+        "project_iid",
+        "level_iid",
+        "layer_iid",
+        "entity_iid",
+    ]
+    TAG_ENUMS: Final[List[str]] = [
+        "entity_tag",
+        "tileset_tag",
+    ]
+
+    @staticmethod
+    def base_file_path() -> Path:
+        return Path("ldtk_gen_config.h")
+
+    def __init__(
+        self,
+        compact: bool,
+        value_counts: Dict[str, int],
+        entity_tables: bool = False,
+        entity_tag_index: bool = False,
+        level_tilesets: bool = False,
+    ):
+        super().__init__()
+        self.add_include("cstdint", is_system_header=True)
+
+        self.compact = compact
+        self.entity_tables = entity_tables
+        # Same as `LayerEntityTagIndexHeader.has_index()`
+        self.entity_tag_index = (
+            entity_tag_index and value_counts.get("entity_tag", 0) != 0
+        )
+        self.level_tilesets = level_tilesets
+        self.underlying_types: Dict[str, str] = {}
+        """Enum name -> Underlying type of it"""
+
+        for enum_name in ConfigHeader.IDENT_ENUMS + ConfigHeader.IID_ENUMS:
+            count = value_counts.get(enum_name, 0)
+            if not compact:
+                self.underlying_types[enum_name] = "int"
+            # Signed, so that `(int)identifier >= 0` asserts don't trip `-Wtype-limits`
+            elif count < 128:
+                self.underlying_types[enum_name] = "std::int8_t"
+            elif count < 32768:
+                self.underlying_types[enum_name] = "std::int16_t"
+            else:
+                self.underlying_types[enum_name] = "std::int32_t"
+
+        self.tag_mask_types: Dict[str, str] = {}
+        """Tag enum name -> Bitmask type of it"""
+
+        for enum_name in ConfigHeader.TAG_ENUMS:
+            count = value_counts.get(enum_name, 0)
+            if count <= 8:
+                self.tag_mask_types[enum_name] = "std::uint8_t"
+            elif count <= 16:
+                self.tag_mask_types[enum_name] = "std::uint16_t"
+            elif count <= 32:
+                self.tag_mask_types[enum_name] = "std::uint32_t"
+            else:
+                self.tag_mask_types[enum_name] = "std::uint64_t"
+
+    def _write_additional_heading(self, source: TextIOWrapper):
+        super()._write_additional_heading(source)
+        source.write(f"#define LDTK_GEN_COMPACT {str(self.compact).lower()}\n")
+        source.write(
+            f"#define LDTK_GEN_ENTITY_TABLES {str(self.entity_tables).lower()}\n"
+        )
+        source.write(
+            f"#define LDTK_GEN_ENTITY_TAG_INDEX {str(self.entity_tag_index).lower()}\n"
+        )
+        source.write(
+            f"#define LDTK_GEN_LEVEL_TILESETS {str(self.level_tilesets).lower()}\n\n"
+        )
+
+    def _write_contents(self, source: TextIOWrapper):
+        for enum_name, underlying_type in self.underlying_types.items():
+            source.write(f"using {enum_name}_underlying_type = {underlying_type};\n")
+        for enum_name, mask_type in self.tag_mask_types.items():
+            source.write(f"using {enum_name}_mask_type = {mask_type};\n")
+
+
 class IdentsHeader(GenHeader):
     class TilesetIdent(NamedTuple):
         tileset_ident: str
@@ -212,47 +704,75 @@ class IdentsHeader(GenHeader):
             key = IdentsHeader.EntityFieldIdent(entity_ident, field_def.identifier)
             self.entity_field_idents.append((key, idx))
 
+    def value_counts(self) -> Dict[str, int]:
+        """Enum name -> Number of values needed to represent every enumerator"""
+        return {
+            "tileset_ident": len(self.tileset_idents),
+            "level_ident": len(self.level_idents),
+            "level_field_ident": len(self.level_field_idents),
+            "layer_ident": len(self.layer_idents),
+            "layer_int_grid_value_ident": 1
+            + max((idx for _, idx in self.layer_int_grid_value_idents), default=0),
+            "layer_int_grid_value_group_ident": 1
+            + max(
+                (idx for _, idx in self.layer_int_grid_value_group_idents), default=0
+            ),
+            "entity_ident": len(self.entity_idents),
+            "entity_field_ident": 1
+            + max((idx for _, idx in self.entity_field_idents), default=0),
+        }
+
     def _write_contents(self, source: TextIOWrapper):
-        source.write("enum class tileset_ident {\n")
+        source.write(
+            "enum class tileset_ident : priv::tileset_ident_underlying_type {\n"
+        )
         for ident in self.tileset_idents:
             source.write(f"    {ident.tileset_ident},\n")
         source.write("};\n\n")
 
-        source.write("enum class level_ident {\n")
+        source.write("enum class level_ident : priv::level_ident_underlying_type {\n")
         for ident in self.level_idents:
             source.write(f"    {ident.level_ident},\n")
         source.write("};\n\n")
 
-        source.write("enum class level_field_ident {\n")
+        source.write(
+            "enum class level_field_ident : priv::level_field_ident_underlying_type {\n"
+        )
         for ident in self.level_field_idents:
             source.write(f"    {ident.field_ident},\n")
         source.write("};\n\n")
 
-        source.write("enum class layer_ident {\n")
+        source.write("enum class layer_ident : priv::layer_ident_underlying_type {\n")
         for ident in self.layer_idents:
             source.write(f"    {ident.layer_ident},\n")
         source.write("};\n\n")
 
-        source.write("enum class layer_int_grid_value_ident {\n")
+        source.write(
+            "enum class layer_int_grid_value_ident : priv::layer_int_grid_value_ident_underlying_type {\n"
+        )
         for ident, idx in self.layer_int_grid_value_idents:
             source.write(
                 f"    LAYER_{ident.layer_ident}_INT_GRID_VALUE_{ident.int_grid_value_ident} = {idx},\n"
             )
         source.write("};\n\n")
 
-        source.write("enum class layer_int_grid_value_group_ident {\n")
+        source.write(
+            "enum class layer_int_grid_value_group_ident : priv::layer_int_grid_value_group_ident_underlying_type {\n"
+        )
         for ident, idx in self.layer_int_grid_value_group_idents:
             source.write(
                 f"    LAYER_{ident.layer_ident}_INT_GRID_VALUE_GROUP_{ident.int_grid_value_group_ident} = {idx},\n"
             )
         source.write("};\n\n")
 
-        source.write("enum class entity_ident {\n")
+        source.write("enum class entity_ident : priv::entity_ident_underlying_type {\n")
         for ident in self.entity_idents:
             source.write(f"    {ident.entity_ident},\n")
         source.write("};\n\n")
 
-        source.write("enum class entity_field_ident {\n")
+        source.write(
+            "enum class entity_field_ident : priv::entity_field_ident_underlying_type {\n"
+        )
         for ident, idx in self.entity_field_idents:
             source.write(
                 f"    ENTITY_{ident.entity_ident}_FIELD_{ident.field_ident} = {idx},\n"
@@ -275,11 +795,23 @@ class IidsHeader(GenHeader):
     def add_iid(self, iid: str, context: str):
         self.iids[context.lower()].add(iid.replace("-", "_"))
 
+    def value_counts(self) -> Dict[str, int]:
+        """Enum name -> Number of values needed to represent every enumerator"""
+        result: Dict[str, int] = {}
+        num_value = 0
+        for context, iids in self.iids.items():
+            num_value += len(iids)
+            result[f"{context}_iid"] = num_value
+        return result
+
     def _write_contents(self, source: TextIOWrapper):
         num_value = 0
         for context, iids in self.iids.items():
-            source.write(f"enum class {context}_iid {{\n")
-            for iid in iids:
+            source.write(
+                f"enum class {context}_iid : priv::{context}_iid_underlying_type {{\n"
+            )
+            # Sorted, so that the output is reproducible regardless of the string hash seed
+            for iid in sorted(iids):
                 source.write(f"    _{iid} = {num_value},\n")
                 num_value += 1
             source.write("};\n\n")
@@ -298,16 +830,33 @@ class TagsHeader(GenHeader):
         """Context -> Set[tag value]"""
 
     def add_tag(self, tag: str, context: str):
-        self.tags[context.lower()].add(tag)
+        tags = self.tags[context.lower()]
+        tags.add(tag)
+        # Tag mask is at most 64 bits
+        if len(tags) > 64:
+            raise TooManyTagsException(len(tags), context.lower())
+
+    def value_counts(self) -> Dict[str, int]:
+        return {f"{context}_tag": len(tags) for context, tags in self.tags.items()}
 
     def _write_contents(self, source: TextIOWrapper):
         for context, tags in self.tags.items():
             source.write(f"enum class {context}_tag {{\n")
-            for tag in tags:
+            # Sorted, so that the tag values (i.e. the tag mask bits) are deterministic
+            for tag in sorted(tags):
                 source.write(f"    {tag},\n")
             source.write("};\n\n")
 
 
+def tag_mask_expression(tags: List[str], context: str) -> str:
+    """
+    Tag mask is expressed with the tag enums, because their values are determined later by the `TagsHeader`.
+    """
+    if len(tags) == 0:
+        return "0"
+    return f"tag_mask({', '.join(f'{context}_tag::{tag}' for tag in tags)})"
+
+
 class EnumsHeader(GenHeader):
     class EnumInfo(NamedTuple):
         storage_bits: int
@@ -369,6 +918,7 @@ class EntityDefinitionsHeader(GenPrivHeader):
         identifier: str
         pivot: FixedPoint
         uid: int
+        tags: List[str]
         max_count: int
         limit_scope: str
 
@@ -393,6 +943,7 @@ class EntityDefinitionsHeader(GenPrivHeader):
                 entity_def.identifier,
                 FixedPoint(entity_def.pivot_x, entity_def.pivot_y),
                 entity_def.uid,
+                entity_def.tags,
                 entity_def.max_count,
                 entity_def.limit_scope.name,
             )
@@ -417,6 +968,7 @@ class EntityDefinitionsHeader(GenPrivHeader):
                     f"        gen_priv_entity_{entity.identifier}_field_definitions,\n"
                 )
                 source.write(f"        gen_priv_entity_{entity.identifier}_tags,\n")
+                source.write(f"        {tag_mask_expression(entity.tags, 'entity')},\n")
                 source.write(f"        {entity.max_count},\n")
                 source.write(
                     f"        entity_definition::limit_scope_kind::{entity.limit_scope}\n"
@@ -502,10 +1054,12 @@ class EntityDefinitionsTagsHeader(GenPrivHeader):
     def base_file_path() -> Path:
         return Path("ldtk_gen_priv_entity_definitions_tags.h")
 
-    def __init__(self):
+    def __init__(self, interner: Optional[ArrayInterner] = None):
         super().__init__()
         self.add_include("ldtk_gen_tags.h")
 
+        self.interner = interner if interner is not None else ArrayInterner()
+
         self.tags: Dict[str, List[str]] = {}
         """Entity identifier -> List[tag]"""
 
@@ -518,6 +1072,17 @@ class EntityDefinitionsTagsHeader(GenPrivHeader):
                 source.write(
                     f"inline constexpr bn::span<const entity_tag> gen_priv_entity_{entity_ident}_tags;\n\n"
                 )
+            elif (
+                interned := self.interner.intern(
+                    str(self.base_file_path()),
+                    "entity_tag",
+                    tags,
+                    f"gen_priv_entity_{entity_ident}_tags",
+                )
+            ) is not None:
+                ArrayInterner.write_alias(
+                    source, f"gen_priv_entity_{entity_ident}_tags", interned
+                )
             else:
                 source.write(
                     f"inline constexpr const entity_tag gen_priv_entity_{entity_ident}_tags[] {{\n"
@@ -768,6 +1333,7 @@ class TilesetDefinitionsHeader(GenPrivHeader):
     class Tileset(NamedTuple):
         identifier: str
         tiles_count: int
+        tags: List[str]
         tags_source_enum_id: Optional[str]
         grid_size: int
         uid: int
@@ -801,6 +1367,7 @@ class TilesetDefinitionsHeader(GenPrivHeader):
             TilesetDefinitionsHeader.Tileset(
                 tileset_def.identifier,
                 tileset_infos.get_tileset_used_tiles_count(tileset_def.uid),
+                tileset_def.tags,
                 (
                     enum_infos.get_enum_name_with_uid(tileset_def.tags_source_enum_uid)
                     if tileset_def.tags_source_enum_uid is not None
@@ -834,6 +1401,9 @@ class TilesetDefinitionsHeader(GenPrivHeader):
                 )
                 source.write(f"        tileset_ident::{tileset.identifier},\n")
                 source.write(f"        gen_priv_tileset_{tileset.identifier}_tags,\n")
+                source.write(
+                    f"        {tag_mask_expression(tileset.tags, 'tileset')},\n"
+                )
                 source.write(
                     f'        {f"bn::type_id<{tileset.tags_source_enum_id}>()" if tileset.tags_source_enum_id is not None else "bn::nullopt"},\n'
                 )
@@ -852,10 +1422,12 @@ class TilesetDefinitionsCustomDatasHeader(GenPrivHeader):
     def base_file_path() -> Path:
         return Path("ldtk_gen_priv_tileset_definitions_custom_datas.h")
 
-    def __init__(self):
+    def __init__(self, interner: Optional[ArrayInterner] = None):
         super().__init__()
         self.add_include("ldtk_tileset_custom_data.h")
 
+        self.interner = interner if interner is not None else ArrayInterner()
+
         self.custom_datas: Dict[
             str, List[TilesetDefinitionsCustomDatasHeader.CustomData]
         ] = {}
@@ -883,6 +1455,17 @@ class TilesetDefinitionsCustomDatasHeader(GenPrivHeader):
                 source.write(
                     f"inline constexpr bn::span<const tileset_custom_data> gen_priv_tileset_{tileset_ident}_custom_datas;\n\n"
                 )
+            elif (
+                interned := self.interner.intern(
+                    str(self.base_file_path()),
+                    "tileset_custom_data",
+                    custom_datas,
+                    f"gen_priv_tileset_{tileset_ident}_custom_datas",
+                )
+            ) is not None:
+                ArrayInterner.write_alias(
+                    source, f"gen_priv_tileset_{tileset_ident}_custom_datas", interned
+                )
             else:
                 source.write(
                     f"inline constexpr const tileset_custom_data gen_priv_tileset_{tileset_ident}_custom_datas[] {{\n"
@@ -939,10 +1522,12 @@ class TilesetDefinitionsEnumTagTileIndexesHeader(GenPrivHeader):
     def base_file_path() -> Path:
         return Path("ldtk_gen_priv_tileset_definitions_enum_tag_tile_indexes.h")
 
-    def __init__(self):
+    def __init__(self, interner: Optional[ArrayInterner] = None):
         super().__init__()
         self.add_include("ldtk_tile_index.h")
 
+        self.interner = interner if interner is not None else ArrayInterner()
+
         self.tile_indexes: Dict[
             TilesetDefinitionsEnumTagTileIndexesHeader.Key, List[int]
         ] = {}
@@ -967,6 +1552,19 @@ class TilesetDefinitionsEnumTagTileIndexesHeader(GenPrivHeader):
                 source.write(
                     f"inline constexpr bn::span<const tile_index> gen_priv_tileset_{key.tileset_ident}_enum_value_{key.enum_value}_tag_tile_indexes;\n\n"
                 )
+            elif (
+                interned := self.interner.intern(
+                    str(self.base_file_path()),
+                    "tile_index",
+                    tile_indexes,
+                    f"gen_priv_tileset_{key.tileset_ident}_enum_value_{key.enum_value}_tag_tile_indexes",
+                )
+            ) is not None:
+                ArrayInterner.write_alias(
+                    source,
+                    f"gen_priv_tileset_{key.tileset_ident}_enum_value_{key.enum_value}_tag_tile_indexes",
+                    interned,
+                )
             else:
                 source.write(
                     f"inline constexpr const tile_index gen_priv_tileset_{key.tileset_ident}_enum_value_{key.enum_value}_tag_tile_indexes[] {{"
@@ -983,10 +1581,12 @@ class TilesetDefinitionsTagsHeader(GenPrivHeader):
     def base_file_path() -> Path:
         return Path("ldtk_gen_priv_tileset_definitions_tags.h")
 
-    def __init__(self):
+    def __init__(self, interner: Optional[ArrayInterner] = None):
         super().__init__()
         self.add_include("ldtk_gen_tags.h")
 
+        self.interner = interner if interner is not None else ArrayInterner()
+
         self.tags: Dict[str, List[str]] = {}
         """Tileset identifier -> List[tag]"""
 
@@ -999,6 +1599,17 @@ class TilesetDefinitionsTagsHeader(GenPrivHeader):
                 source.write(
                     f"inline constexpr bn::span<const tileset_tag> gen_priv_tileset_{tileset_ident}_tags;\n\n"
                 )
+            elif (
+                interned := self.interner.intern(
+                    str(self.base_file_path()),
+                    "tileset_tag",
+                    tags,
+                    f"gen_priv_tileset_{tileset_ident}_tags",
+                )
+            ) is not None:
+                ArrayInterner.write_alias(
+                    source, f"gen_priv_tileset_{tileset_ident}_tags", interned
+                )
             else:
                 source.write(
                     f"inline constexpr const tileset_tag gen_priv_tileset_{tileset_ident}_tags[] {{\n"
@@ -1008,7 +1619,97 @@ class TilesetDefinitionsTagsHeader(GenPrivHeader):
                 source.write("};\n\n")
 
 
-class LevelsHeader(GenPrivHeader):
+class ExternDefinitionsHeader(GenPrivHeader):
+    """Header whose definitions can be moved into the `LevelsSource`, leaving only the `extern` declarations.
+
+    This way, including the header doesn't parse & evaluate the whole level graph anymore.
+    """
+
+    def __init__(self, extern: bool):
+        super().__init__()
+
+        self.extern = extern
+        self.definition_includes: Dict[str, bool] = {}
+
+    def add_definition_include(
+        self, include_header_filename: str, is_system_header: bool = False
+    ):
+        """Adds an include only required by the definitions"""
+        if self.extern:
+            self.definition_includes[include_header_filename] = is_system_header
+        else:
+            self.add_include(include_header_filename, is_system_header)
+
+    @abstractmethod
+    def has_definitions(self) -> bool:
+        pass
+
+    @abstractmethod
+    def _write_definitions(self, source: TextIOWrapper, specifier: str):
+        pass
+
+
+class LevelsSource(GenPrivSource):
+    """Defines the `extern` objects of the `ExternDefinitionsHeader`s, so that only this TU evaluates the level graph"""
+
+    @staticmethod
+    def base_file_path() -> Path:
+        return Path("ldtk_gen_priv_levels.cpp")
+
+    def __init__(self, headers: List[ExternDefinitionsHeader]):
+        super().__init__()
+
+        self.headers = [
+            header for header in headers if header.extern and header.has_definitions()
+        ]
+        for header in self.headers:
+            self.add_include(str(header.base_file_path()))
+        for header in self.headers:
+            for (
+                include_header_filename,
+                is_system_header,
+            ) in header.definition_includes.items():
+                self.add_include(include_header_filename, is_system_header)
+
+    def _write_contents(self, source: TextIOWrapper):
+        for header in self.headers:
+            header._write_definitions(source, "constexpr")
+
+
+class LevelSource(GenPrivSource):
+    """Defines the `extern` objects of a single level of the `LevelSplitHeader`s, so that editing a level only recompiles this TU.
+
+    Must be written before the headers flush the level, as flushing frees its contents.
+    """
+
+    def __init__(self, level_ident: str, headers: List[LevelSplitHeader]):
+        super().__init__()
+
+        self.level_ident = level_ident
+        self.headers = [
+            header
+            for header in headers
+            if header.extern_definitions and level_ident in header._level_idents()
+        ]
+        for header in self.headers:
+            self.add_include(str(header.base_file_path()))
+        for header in self.headers:
+            for include_header_filename, is_system_header in header.part_includes:
+                self.add_include(include_header_filename, is_system_header)
+            for dependency_include in header.dependency_includes(level_ident):
+                self.add_include(dependency_include)
+
+    def base_file_path(
+        self,
+    ) -> Path:  # pyright: ignore[reportIncompatibleMethodOverride]
+        return Path(f"ldtk_gen_priv_level_{self.level_ident}.cpp")
+
+    def _write_contents(self, source: TextIOWrapper):
+        for header in self.headers:
+            header._write_level_definitions(self.level_ident, source, "constexpr")
+
+
+class LevelsHeader(ExternDefinitionsHeader):
     class LevelInfo(NamedTuple):
         bg_color: Color
         identifier: str
@@ -1017,57 +1718,86 @@ class LevelsHeader(GenPrivHeader):
         uid: int
         world_depth: int
         world_coord: Point
+        field_instances_offset: int
+        field_instances_count: int
 
     @staticmethod
     def base_file_path() -> Path:
         return Path("ldtk_gen_priv_levels.h")
 
-    def __init__(self, levels: List[LdtkJson.Level]):
-        super().__init__()
+    def __init__(
+        self, levels: List[LdtkJson.Level], compact: bool = False, extern: bool = False
+    ):
+        super().__init__(extern)
         self.add_include("ldtk_level.h")
-        self.add_include("ldtk_gen_idents.h")
-        self.add_include("ldtk_gen_iids.h")
-        self.add_include("ldtk_gen_priv_level_field_instances.h")
-        self.add_include("ldtk_gen_priv_level_layer_instances.h")
-
-        self.levels: List[LevelsHeader.LevelInfo] = [
-            LevelsHeader.LevelInfo(
-                Color(level.bg_color),
-                level.identifier,
-                level.iid.replace("-", "_"),
-                Size(level.px_wid, level.px_hei),
-                level.uid,
-                level.world_depth,
-                Point(level.world_x, level.world_y),
-            )
-            for level in levels
-        ]
+        self.add_definition_include("ldtk_gen_idents.h")
+        self.add_definition_include("ldtk_gen_iids.h")
+        self.add_definition_include("ldtk_gen_priv_level_field_instances.h")
+        self.add_definition_include("ldtk_gen_priv_level_layer_instances.h")
+
+        self.compact = compact
+
+        self.levels: List[LevelsHeader.LevelInfo] = []
+        # Same order as the level field pool of the `LevelFieldInstancesHeader`
+        field_instances_offset = 0
+        for level in levels:
+            self.levels.append(
+                LevelsHeader.LevelInfo(
+                    Color(level.bg_color),
+                    level.identifier,
+                    level.iid.replace("-", "_"),
+                    Size(level.px_wid, level.px_hei),
+                    level.uid,
+                    level.world_depth,
+                    Point(level.world_x, level.world_y),
+                    field_instances_offset,
+                    len(level.field_instances),
+                )
+            )
+            field_instances_offset += len(level.field_instances)
+
+    def has_definitions(self) -> bool:
+        return len(self.levels) != 0
 
     def _write_contents(self, source: TextIOWrapper):
-        if len(self.levels) == 0:
+        if not self.has_definitions():
             source.write("inline constexpr bn::span<const level> gen_priv_levels;\n")
+        elif self.extern:
+            source.write(f"extern const level gen_priv_levels[{len(self.levels)}];\n")
         else:
-            source.write("inline constexpr const level gen_priv_levels[] {\n")
-            for level in self.levels:
-                source.write("    level(\n")
-                source.write(f"        {level.bg_color},\n")
+            self._write_definitions(source, "inline constexpr")
+
+    def _write_definitions(self, source: TextIOWrapper, specifier: str):
+        source.write(f"{specifier} const level gen_priv_levels[] {{\n")
+        for level in self.levels:
+            source.write("    level(\n")
+            source.write(f"        {level.bg_color},\n")
+            if self.compact:
+                source.write(f"        {level.field_instances_offset},\n")
+                source.write(f"        {level.field_instances_count},\n")
+            else:
                 source.write(
                     f"        gen_priv_level_{level.identifier}_field_instances,\n"
                 )
-                source.write(f"        level_ident::{level.identifier},\n")
-                source.write(f"        level_iid::_{level.iid},\n")
-                source.write(
-                    f"        gen_priv_level_{level.identifier}_layer_instances,\n"
-                )
-                source.write(f"        {level.px_size},\n")
-                source.write(f"        {level.uid},\n")
-                source.write(f"        {level.world_depth},\n")
-                source.write(f"        {level.world_coord}\n")
-                source.write("    ),\n")
-            source.write("};\n")
+            source.write(f"        level_ident::{level.identifier},\n")
+            source.write(f"        level_iid::_{level.iid},\n")
+            source.write(
+                f"        gen_priv_level_{level.identifier}_layer_instances,\n"
+            )
+            source.write(f"        {level.px_size},\n")
+            source.write(f"        {level.uid},\n")
+            source.write(f"        {level.world_depth},\n")
+            source.write(f"        {level.world_coord}\n")
+            source.write("    ),\n")
+        source.write("};\n")
 
 
-class LevelFieldInstancesHeader(GenPrivHeader):
+class LevelFieldInstancesHeader(ExternDefinitionsHeader, LevelSplitHeader):
+    """
+    With `compact`, the field instances of every level are in a single project-wide pool in this header.
+    Otherwise, they're split per level, and defined in the `LevelSource`s with `extern`.
+    """
+
     @staticmethod
     def base_file_path() -> Path:
         return Path("ldtk_gen_priv_level_field_instances.h")
@@ -1076,21 +1806,43 @@ class LevelFieldInstancesHeader(GenPrivHeader):
     def parent_type() -> str:
         return "level"
 
-    def __init__(self):
-        super().__init__()
-        self.add_include("cstdint", is_system_header=True)
+    def __init__(self, compact: bool = False, extern: bool = False):
+        # Only the compact pool is reachable from the library headers
+        super().__init__(extern and compact)
+        self.extern_definitions = extern and not compact
         self.add_include("ldtk_field.h")
-        self.add_include(f"ldtk_gen_priv_{self.parent_type()}_field_definitions.h")
-        self.add_include(f"ldtk_gen_priv_{self.parent_type()}_field_arrays.h")
-        self.add_include("ldtk_gen_enums.h")
-        self.add_include("ldtk_gen_idents.h")
-        self.add_include("ldtk_gen_iids.h")
+
+        self.compact = compact
+        if compact:
+            self.add_definition_include("cstdint", is_system_header=True)
+            self.add_definition_include(
+                f"ldtk_gen_priv_{self.parent_type()}_field_definitions.h"
+            )
+            self.add_definition_include(
+                f"ldtk_gen_priv_{self.parent_type()}_field_arrays.h"
+            )
+            self.add_definition_include("ldtk_gen_enums.h")
+            self.add_definition_include("ldtk_gen_idents.h")
+            self.add_definition_include("ldtk_gen_iids.h")
+        else:
+            # The field arrays of the level are included by `add_level_dependency()`
+            self.add_part_include("cstdint", is_system_header=True)
+            self.add_part_include("ldtk_field.h")
+            self.add_part_include(
+                f"ldtk_gen_priv_{self.parent_type()}_field_definitions.h"
+            )
+            self.add_part_include("ldtk_gen_enums.h")
+            self.add_part_include("ldtk_gen_idents.h")
+            self.add_part_include("ldtk_gen_iids.h")
 
         self.fields: Dict[str, List[str]] = {}
         """Parent id -> List[field value]"""
+        self.parent_levels: Dict[str, str] = {}
+        """Parent id -> Level identifier"""
 
     def add_fields(
         self,
+        level_ident: str,
         parent_id: str,
         fields: List[LdtkJson.FieldInstance],
         layer_iid_to_ident: Dict[str, str],
@@ -1188,23 +1940,117 @@ class LevelFieldInstancesHeader(GenPrivHeader):
                     raise UnsupportedFieldTypeException(field.type, f'"{parent_id}"')
 
         self.fields[parent_id] = result
+        self.parent_levels[parent_id] = level_ident
+
+    def splits_levels(self) -> bool:
+        return not self.compact
+
+    def _level_idents(self) -> List[str]:
+        if self.compact:
+            return []
+        return list(dict.fromkeys(self.parent_levels.values()))
+
+    def _free_level(self, level_ident: str):
+        for parent_id in self._level_parent_ids(level_ident):
+            del self.fields[parent_id]
+            del self.parent_levels[parent_id]
+
+    def _level_parent_ids(self, level_ident: str) -> List[str]:
+        return [
+            parent_id
+            for parent_id, parent_level in self.parent_levels.items()
+            if parent_level == level_ident
+        ]
 
-    def _write_contents(self, source: TextIOWrapper):
-        for parent_id, fields in self.fields.items():
-            if len(fields) == 0:
+    def _field_instances_name(self, parent_id: str) -> str:
+        return f"gen_priv_{self.parent_type()}_{parent_id}_field_instances"
+
+    def _write_level_contents(
+        self, level_ident: str, source: TextIOWrapper, level_includes: List[Path]
+    ):
+        self._write_empty_field_instances(level_ident, source)
+        self._write_level_definitions(level_ident, source, "inline constexpr")
+
+    def _write_level_declarations(self, level_ident: str, source: TextIOWrapper):
+        self._write_empty_field_instances(level_ident, source)
+        for parent_id in self._level_parent_ids(level_ident):
+            fields = self.fields[parent_id]
+            if len(fields) != 0:
                 source.write(
-                    f"inline constexpr bn::span<const field> gen_priv_{self.parent_type()}_{parent_id}_field_instances;\n\n"
+                    f"extern const field {self._field_instances_name(parent_id)}[{len(fields)}];\n\n"
                 )
-            else:
+
+    def _write_empty_field_instances(self, level_ident: str, source: TextIOWrapper):
+        for parent_id in self._level_parent_ids(level_ident):
+            if len(self.fields[parent_id]) == 0:
                 source.write(
-                    f"inline constexpr const field gen_priv_{self.parent_type()}_{parent_id}_field_instances[] {{\n"
+                    f"inline constexpr bn::span<const field> {self._field_instances_name(parent_id)};\n\n"
                 )
-                for field_idx, field in enumerate(fields):
-                    source.write("    field(\n")
-                    self._write_definition(field_idx, parent_id, source)
-                    source.write(f"        {field}\n")
-                    source.write("    ),\n")
-                source.write("};\n\n")
+
+    def _write_level_definitions(
+        self, level_ident: str, source: TextIOWrapper, specifier: str
+    ):
+        for parent_id in self._level_parent_ids(level_ident):
+            fields = self.fields[parent_id]
+            if len(fields) == 0:
+                continue
+
+            source.write(
+                f"{specifier} const field {self._field_instances_name(parent_id)}[] {{\n"
+            )
+            for field_idx, field in enumerate(fields):
+                source.write("    field(\n")
+                self._write_definition(field_idx, parent_id, source)
+                source.write(f"        {field}\n")
+                source.write("    ),\n")
+            source.write("};\n\n")
+
+    def _write_contents(self, source: TextIOWrapper):
+        if self.compact:
+            self._write_pool(source)
+        else:
+            super()._write_contents(source)
+
+    def pool_size(self) -> int:
+        return sum(len(fields) for fields in self.fields.values())
+
+    def has_definitions(self) -> bool:
+        return self.compact and self.pool_size() != 0
+
+    def _write_pool(self, source: TextIOWrapper):
+        """Writes every field instances into a single project-wide pool, in the insertion order"""
+        pool_name = f"gen_priv_{self.parent_type()}_field_instances"
+        if not self.has_definitions():
+            source.write(
+                f"constexpr auto gen_priv_{self.parent_type()}_field_pool() -> const field*\n"
+            )
+            source.write("{\n")
+            source.write("    return nullptr;\n")
+            source.write("}\n")
+            return
+
+        if self.extern:
+            source.write(f"extern const field {pool_name}[{self.pool_size()}];\n\n")
+        else:
+            self._write_definitions(source, "inline constexpr")
+
+        source.write(
+            f"constexpr auto gen_priv_{self.parent_type()}_field_pool() -> const field*\n"
+        )
+        source.write("{\n")
+        source.write(f"    return {pool_name};\n")
+        source.write("}\n")
+
+    def _write_definitions(self, source: TextIOWrapper, specifier: str):
+        pool_name = f"gen_priv_{self.parent_type()}_field_instances"
+        source.write(f"{specifier} const field {pool_name}[] {{\n")
+        for parent_id, fields in self.fields.items():
+            for field_idx, field in enumerate(fields):
+                source.write("    field(\n")
+                self._write_definition(field_idx, parent_id, source)
+                source.write(f"        {field}\n")
+                source.write("    ),\n")
+        source.write("};\n\n")
 
     def _write_definition(self, field_idx: int, parent_id: str, source: TextIOWrapper):
         source.write(
@@ -1212,8 +2058,9 @@ class LevelFieldInstancesHeader(GenPrivHeader):
         )
 
 
-class LevelFieldArraysHeader(GenPrivHeader):
+class LevelFieldArraysHeader(LevelSplitHeader):
     class Key(NamedTuple):
+        level_ident: str
         parent_id: str
         field_ident: str
 
@@ -1262,24 +2109,27 @@ class LevelFieldArraysHeader(GenPrivHeader):
     def parent_type() -> str:
         return "level"
 
-    def __init__(self):
+    def __init__(self, interner: Optional[ArrayInterner] = None):
         super().__init__()
-        self.add_include("cstdint", is_system_header=True)
-        self.add_include("bn_color.h", is_system_header=True)
-        self.add_include("bn_fixed.h", is_system_header=True)
-        self.add_include("bn_optional.h", is_system_header=True)
-        self.add_include("bn_point.h", is_system_header=True)
-        self.add_include("bn_string_view.h", is_system_header=True)
-        self.add_include("ldtk_priv_typed_enum.h")
-        self.add_include("ldtk_entity_ref.h")
-        self.add_include("ldtk_gen_idents.h")
-        self.add_include("ldtk_gen_iids.h")
-        self.add_include("ldtk_gen_enums.h")
+        self.add_part_include("cstdint", is_system_header=True)
+        self.add_part_include("bn_color.h", is_system_header=True)
+        self.add_part_include("bn_fixed.h", is_system_header=True)
+        self.add_part_include("bn_optional.h", is_system_header=True)
+        self.add_part_include("bn_point.h", is_system_header=True)
+        self.add_part_include("bn_string_view.h", is_system_header=True)
+        self.add_part_include("ldtk_priv_typed_enum.h")
+        self.add_part_include("ldtk_entity_ref.h")
+        self.add_part_include("ldtk_gen_idents.h")
+        self.add_part_include("ldtk_gen_iids.h")
+        self.add_part_include("ldtk_gen_enums.h")
+
+        self.interner = interner if interner is not None else ArrayInterner()
 
         self.arrays: Dict[LevelFieldArraysHeader.Key, LevelFieldArraysHeader.Value] = {}
 
     def add_field_array(
         self,
+        level_ident: str,
         parent_id: str,
         field: LdtkJson.FieldInstance,
         field_def: LdtkJson.FieldDefinition,
@@ -1449,17 +2299,46 @@ class LevelFieldArraysHeader(GenPrivHeader):
             case _:
                 raise AssertionError(f"Invalid parsed field type: {parsed.field_type}")
 
-        self.arrays[LevelFieldArraysHeader.Key(parent_id, field.identifier)] = value
+        self.arrays[
+            LevelFieldArraysHeader.Key(level_ident, parent_id, field.identifier)
+        ] = value
 
-    def _write_contents(self, source: TextIOWrapper):
+    def _level_idents(self) -> List[str]:
+        return list(dict.fromkeys(key.level_ident for key in self.arrays))
+
+    def _free_level(self, level_ident: str):
+        self.arrays = {
+            key: value
+            for key, value in self.arrays.items()
+            if key.level_ident != level_ident
+        }
+
+    def _write_level_contents(
+        self, level_ident: str, source: TextIOWrapper, level_includes: List[Path]
+    ):
         for key, value in self.arrays.items():
+            if key.level_ident != level_ident:
+                continue
+
+            array_name = f"gen_priv_{self.parent_type()}_{key.parent_id}_field_{key.field_ident}_array"
             if len(value.elements) == 0:
                 source.write(
-                    f"inline constexpr bn::span<const {value.element_type}> gen_priv_{self.parent_type()}_{key.parent_id}_field_{key.field_ident}_array;\n\n"
+                    f"inline constexpr bn::span<const {value.element_type}> {array_name};\n\n"
                 )
+            elif (
+                interned := self._intern(
+                    self.interner,
+                    level_ident,
+                    level_includes,
+                    value.element_type,
+                    value.elements,
+                    array_name,
+                )
+            ) is not None:
+                ArrayInterner.write_alias(source, array_name, interned)
             else:
                 source.write(
-                    f"inline constexpr const {value.element_type} gen_priv_{self.parent_type()}_{key.parent_id}_field_{key.field_ident}_array[] {{"
+                    f"inline constexpr const {value.element_type} {array_name}[] {{"
                 )
                 for i, elem in enumerate(value.elements):
                     if i % 16 == 0:
@@ -1468,7 +2347,109 @@ class LevelFieldArraysHeader(GenPrivHeader):
                 source.write("\n};\n\n")
 
 
-class LevelLayerInstancesHeader(GenPrivHeader):
+class LevelTilesetSubsetsHeader(LevelSplitHeader):
+    class Subset(NamedTuple):
+        level_ident: str
+        tileset_ident: str
+        tile_remap: List[int]
+
+    @staticmethod
+    def base_file_path() -> Path:
+        return Path("ldtk_gen_priv_level_tileset_subsets.h")
+
+    def __init__(self, interner: ArrayInterner, enabled: bool = False):
+        super().__init__()
+        self.add_part_include("ldtk_tileset_subset.h")
+        self.add_part_include("ldtk_tile_index.h")
+
+        self.interner = interner
+        self.enabled = enabled
+
+        self.subsets: List[LevelTilesetSubsetsHeader.Subset] = []
+
+    def add_level(
+        self,
+        level_ident: str,
+        tileset_defs: List[LdtkJson.TilesetDefinition],
+        tileset_infos: TilesetInfos,
+    ):
+        if not self.enabled:
+            return
+
+        for tileset_def in tileset_defs:
+            used_tile_idxes = tileset_infos.get_level_tileset_used_tile_idxes(
+                level_ident, tileset_def.uid
+            )
+            if used_tile_idxes is None:
+                continue
+
+            # Tile index 0 is the empty tile on both, and the unused tiles become the empty tile
+            tile_remap = [0] * (
+                1 + tileset_infos.get_tileset_used_tiles_count(tileset_def.uid)
+            )
+            for subset_tile_idx, tile_idx in enumerate(used_tile_idxes):
+                tile_remap[1 + tile_idx] = 1 + subset_tile_idx
+
+            self.subsets.append(
+                LevelTilesetSubsetsHeader.Subset(
+                    level_ident, tileset_def.identifier, tile_remap
+                )
+            )
+
+    def _level_idents(self) -> List[str]:
+        return list(dict.fromkeys(subset.level_ident for subset in self.subsets))
+
+    def _free_level(self, level_ident: str):
+        self.subsets = [
+            subset for subset in self.subsets if subset.level_ident != level_ident
+        ]
+
+    def _write_level_contents(
+        self, level_ident: str, source: TextIOWrapper, level_includes: List[Path]
+    ):
+        for subset in self.subsets:
+            if subset.level_ident != level_ident:
+                continue
+
+            level_includes.append(
+                Path(
+                    f"bn_regular_bg_items_ldtk_gen_priv_tileset_{subset.tileset_ident}_level_{level_ident}.h"
+                )
+            )
+            prefix = f"gen_priv_level_{level_ident}_tileset_{subset.tileset_ident}"
+
+            interned = self._intern(
+                self.interner,
+                level_ident,
+                level_includes,
+                "tile_index",
+                subset.tile_remap,
+                f"{prefix}_tile_remap",
+            )
+            if interned is not None:
+                ArrayInterner.write_alias(source, f"{prefix}_tile_remap", interned)
+            else:
+                source.write(
+                    f"inline constexpr const tile_index {prefix}_tile_remap[] {{"
+                )
+                source.write(",".join(str(idx) for idx in subset.tile_remap))
+                source.write("};\n\n")
+
+            source.write(f"inline constexpr tileset_subset {prefix}_subset(\n")
+            source.write(
+                f"    bn::regular_bg_items::ldtk_gen_priv_tileset_{subset.tileset_ident}_level_{subset.level_ident},\n"
+            )
+            source.write(f"    {prefix}_tile_remap\n")
+            source.write(");\n\n")
+
+
+class LevelLayerInstancesHeader(LevelSplitHeader):
+    """
+    Layer instances of each level, which refer to the grids, entities & tileset subsets of the same level.
+
+    With `extern`, they're defined in the `LevelSource`s, and only declared here.
+    """
+
     class LayerInfo(NamedTuple):
         layer_ident: str
         tileset_def_idx: Optional[int]
@@ -1479,22 +2460,37 @@ class LevelLayerInstancesHeader(GenPrivHeader):
         has_int_grid_csv: bool
         iid: str
         visible: bool
+        entity_instances_offset: int
+        entity_instances_count: int
+        tileset_subset_ident: Optional[str]
+        """Tileset identifier, if the tileset subset of the level is generated"""
 
     @staticmethod
     def base_file_path() -> Path:
         return Path("ldtk_gen_priv_level_layer_instances.h")
 
-    def __init__(self):
-        super().__init__()
+    def __init__(
+        self,
+        compact: bool = False,
+        entity_tables: bool = False,
+        entity_tag_index: bool = False,
+        level_tilesets: bool = False,
+        extern: bool = False,
+    ):
+        super().__init__(extern)
         self.add_include("ldtk_layer.h")
-        self.add_include("ldtk_gen_priv_layer_definitions.h")
-        self.add_include("ldtk_gen_priv_tileset_definitions.h")
-        self.add_include("ldtk_gen_priv_layer_auto_layer_tiles.h")
-        self.add_include("ldtk_gen_priv_layer_entity_instances.h")
-        self.add_include("ldtk_gen_priv_layer_grid_tiles.h")
-        self.add_include("ldtk_gen_priv_layer_int_grids.h")
-        self.add_include("ldtk_gen_idents.h")
-        self.add_include("ldtk_gen_iids.h")
+        # The grids, entities & tileset subsets of the level are included by `add_level_dependency()`
+        self.add_part_include("ldtk_layer.h")
+        self.add_part_include("ldtk_gen_priv_layer_definitions.h")
+        self.add_part_include("ldtk_gen_priv_tileset_definitions.h")
+        self.add_part_include("ldtk_gen_idents.h")
+        self.add_part_include("ldtk_gen_iids.h")
+
+        self.compact = compact
+        self.entity_tables = entity_tables
+        self.entity_tag_index = entity_tag_index
+        self.level_tilesets = level_tilesets
+        self.entity_pool_size = 0
 
         self.layers: Dict[str, List[LevelLayerInstancesHeader.LayerInfo]] = {}
         """Level identifier -> List[LayerInfo]"""
@@ -1522,47 +2518,100 @@ class LevelLayerInstancesHeader(GenPrivHeader):
                     len(layer.int_grid_csv) != 0,
                     layer.iid.replace("-", "_"),
                     layer.visible,
+                    # Same order as the entity pool of the `LayerEntityInstancesHeader`
+                    self.entity_pool_size,
+                    len(layer.entity_instances),
+                    (
+                        tileset_infos.get_tileset_def(layer.tileset_def_uid).identifier
+                        if self.level_tilesets
+                        and layer.tileset_def_uid is not None
+                        and tileset_infos.get_level_tileset_used_tile_idxes(
+                            level_ident, layer.tileset_def_uid
+                        )
+                        is not None
+                        else None
+                    ),
                 )
             )
+            self.entity_pool_size += len(layer.entity_instances)
         self.layers[level_ident] = result
 
-    def _write_contents(self, source: TextIOWrapper):
-        for level_ident, layers in self.layers.items():
-            if len(layers) == 0:
-                source.write(
-                    f"inline constexpr bn::span<const layer> gen_priv_level_{level_ident}_layer_instances;\n\n"
-                )
+    def _level_idents(self) -> List[str]:
+        return list(self.layers)
+
+    def _free_level(self, level_ident: str):
+        del self.layers[level_ident]
+
+    def _write_level_contents(
+        self, level_ident: str, source: TextIOWrapper, level_includes: List[Path]
+    ):
+        self._write_empty_layer_instances(level_ident, source)
+        self._write_level_definitions(level_ident, source, "inline constexpr")
+
+    def _write_level_declarations(self, level_ident: str, source: TextIOWrapper):
+        self._write_empty_layer_instances(level_ident, source)
+        layers = self.layers[level_ident]
+        if len(layers) != 0:
+            source.write(
+                f"extern const layer gen_priv_level_{level_ident}_layer_instances[{len(layers)}];\n\n"
+            )
+
+    def _write_empty_layer_instances(self, level_ident: str, source: TextIOWrapper):
+        if len(self.layers[level_ident]) == 0:
+            source.write(
+                f"inline constexpr bn::span<const layer> gen_priv_level_{level_ident}_layer_instances;\n\n"
+            )
+
+    def _write_level_definitions(
+        self, level_ident: str, source: TextIOWrapper, specifier: str
+    ):
+        layers = self.layers[level_ident]
+        if len(layers) == 0:
+            return
+
+        source.write(
+            f"{specifier} const layer gen_priv_level_{level_ident}_layer_instances[] {{\n"
+        )
+        for layer_idx, layer in enumerate(layers):
+            source.write("    layer(\n")
+            source.write(f"        gen_priv_layer_definitions[{layer_idx}],\n")
+            source.write(
+                f"        {f'&gen_priv_tileset_definitions[{layer.tileset_def_idx}]' if layer.tileset_def_idx is not None else 'nullptr'},\n"
+            )
+            source.write(f"        {layer.c_size},\n")
+            source.write(f"        {layer.px_total_offset},\n")
+            source.write(
+                f"        {f'&gen_priv_level_{level_ident}_layer_{layer.layer_ident}_auto_layer_tiles' if layer.has_auto_layer_tiles else 'nullptr'},\n"
+            )
+            source.write(
+                f"        {f'&gen_priv_level_{level_ident}_layer_{layer.layer_ident}_grid_tiles' if layer.has_grid_tiles else 'nullptr'},\n"
+            )
+            source.write(
+                f"        {f'&gen_priv_level_{level_ident}_layer_{layer.layer_ident}_int_grid' if layer.has_int_grid_csv else 'nullptr'},\n"
+            )
+            if self.compact:
+                source.write(f"        {layer.entity_instances_offset},\n")
+                source.write(f"        {layer.entity_instances_count},\n")
             else:
                 source.write(
-                    f"inline constexpr const layer gen_priv_level_{level_ident}_layer_instances[] {{\n"
+                    f"        gen_priv_level_{level_ident}_layer_{layer.layer_ident}_entities,\n"
                 )
-                for layer_idx, layer in enumerate(layers):
-                    source.write("    layer(\n")
-                    source.write(f"        gen_priv_layer_definitions[{layer_idx}],\n")
-                    source.write(
-                        f"        {f'&gen_priv_tileset_definitions[{layer.tileset_def_idx}]' if layer.tileset_def_idx is not None else 'nullptr'},\n"
-                    )
-                    source.write(f"        {layer.c_size},\n")
-                    source.write(f"        {layer.px_total_offset},\n")
-                    source.write(
-                        f"        {f'&gen_priv_level_{level_ident}_layer_{layer.layer_ident}_auto_layer_tiles' if layer.has_auto_layer_tiles else 'nullptr'},\n"
-                    )
-                    source.write(
-                        f"        {f'&gen_priv_level_{level_ident}_layer_{layer.layer_ident}_grid_tiles' if layer.has_grid_tiles else 'nullptr'},\n"
-                    )
-                    source.write(
-                        f"        {f'&gen_priv_level_{level_ident}_layer_{layer.layer_ident}_int_grid' if layer.has_int_grid_csv else 'nullptr'},\n"
-                    )
-                    source.write(
-                        f"        gen_priv_level_{level_ident}_layer_{layer.layer_ident}_entities,\n"
-                    )
-                    source.write(f"        layer_iid::_{layer.iid},\n")
-                    source.write(f"        {str(layer.visible).lower()}\n")
-                    source.write("    ),\n")
-                source.write("};\n\n")
+            source.write(
+                f"        {f'&gen_priv_level_{level_ident}_layer_{layer.layer_ident}_entity_table' if self.entity_tables else 'nullptr'},\n"
+            )
+            source.write(
+                f"        {f'gen_priv_level_{level_ident}_layer_{layer.layer_ident}_entity_tag_index' if self.entity_tag_index else 'nullptr'},\n"
+            )
+            source.write(
+                f"        {f'&gen_priv_level_{level_ident}_tileset_{layer.tileset_subset_ident}_subset' if layer.tileset_subset_ident is not None else 'nullptr'},\n"
+            )
+            source.write(f"        layer_iid::_{layer.iid},\n")
+            source.write(f"        {str(layer.visible).lower()}\n")
+            source.write("    ),\n")
+        source.write("};\n\n")
 
 
-class LayerAutoLayerTilesHeader(GenPrivHeader):
+class LayerAutoLayerTilesHeader(LevelSplitHeader):
     class GridInfo(NamedTuple):
         level_ident: str
         layer_ident: str
@@ -1575,9 +2624,9 @@ class LayerAutoLayerTilesHeader(GenPrivHeader):
 
     def __init__(self):
         super().__init__()
-        self.add_include("type_traits", is_system_header=True)
-        self.add_include("ldtk_tile_grid_t.h")
-        self.add_include(f"ldtk_gen_priv_layer_{self.tiles_type()}_cells.h")
+        # The cells of the level are included by `add_level_dependency()`
+        self.add_part_include("type_traits", is_system_header=True)
+        self.add_part_include("ldtk_tile_grid_t.h")
 
         self.grids: List[LayerAutoLayerTilesHeader.GridInfo] = []
 
@@ -1592,13 +2641,24 @@ class LayerAutoLayerTilesHeader(GenPrivHeader):
     def tiles_type() -> str:
         return "auto_layer_tiles"
 
-    def _write_contents(self, source: TextIOWrapper):
+    def _level_idents(self) -> List[str]:
+        return list(dict.fromkeys(grid.level_ident for grid in self.grids))
+
+    def _free_level(self, level_ident: str):
+        self.grids = [grid for grid in self.grids if grid.level_ident != level_ident]
+
+    def _write_level_contents(
+        self, level_ident: str, source: TextIOWrapper, level_includes: List[Path]
+    ):
         for grid in self.grids:
+            if grid.level_ident != level_ident:
+                continue
+
             grid_ident = f"gen_priv_level_{grid.level_ident}_layer_{grid.layer_ident}_{self.tiles_type()}"
             cells_ident = grid_ident + "_cells"
 
             source.write(
-                f"inline constexpr const tile_grid_t<sizeof(std::remove_extent_t<decltype({cells_ident})>) >= 2> {grid_ident}(\n"
+                f"inline constexpr const tile_grid_t<sizeof(std::remove_extent_t<std::remove_reference_t<decltype({cells_ident})>>) >= 2> {grid_ident}(\n"
             )
             source.write(f"    {grid.width},\n")
             source.write(f"    {grid.height},\n")
@@ -1606,31 +2666,48 @@ class LayerAutoLayerTilesHeader(GenPrivHeader):
             source.write(");\n\n")
 
 
-class LayerAutoLayerTilesCellsHeader(GenPrivHeader):
+CELL_TYPECODES: Final[Dict[int, str]] = {8: "B", 16: "H", 32: "I"}
+"""Cell bits -> `array` typecode, which is much more compact than a `list` of `int`s"""
+
+
+def format_cells_body(cells: Sequence[int], width: int) -> str:
+    """Formats the cells of a grid array, one row per line"""
+    return "".join(
+        "\n    " + "".join(f"{cell}, " for cell in cells[row : row + width])
+        for row in range(0, len(cells), width)
+    )
+
+
+class LayerAutoLayerTilesCellsHeader(LayerCellsHeader):
     class CellsInfo(NamedTuple):
         level_ident: str
         layer_ident: str
         bloated: bool
-        cells: List[int]
-        width: int
+        cells: "array[int]"
+        body: str
+        """Pre-formatted cells, so that it can be done in parallel"""
 
     @staticmethod
     def base_file_path() -> Path:
         return Path("ldtk_gen_priv_layer_auto_layer_tiles_cells.h")
 
-    def __init__(self):
-        super().__init__()
-        self.add_include("cstdint", is_system_header=True)
+    def __init__(self, interner: Optional[ArrayInterner] = None, binary: bool = False):
+        super().__init__(interner, binary)
 
         self.cells: List[LayerAutoLayerTilesCellsHeader.CellsInfo] = []
 
-    def add_tiles(
-        self,
+    def add_cells_info(self, info: "LayerAutoLayerTilesCellsHeader.CellsInfo"):
+        self.cells.append(info)
+
+    @staticmethod
+    def parse_tiles(
         tiles: List[LdtkJson.TileInstance],
         level_ident: str,
         layer: LdtkJson.LayerInstance,
-        tileset_infos: TilesetInfos,
-    ):
+        used_tile_idxes: Dict[Point, int],
+        binary: bool = False,
+    ) -> "LayerAutoLayerTilesCellsHeader.CellsInfo":
+        """Doesn't touch any header state, so that it can be run in a worker process"""
         assert layer.tileset_def_uid is not None and len(tiles) != 0
 
         # Determine whether to use `u8` or `u16` for cell storage
@@ -1641,15 +2718,15 @@ class LayerAutoLayerTilesCellsHeader(GenPrivHeader):
             pos = Point(tile.px[0] // layer.grid_size, tile.px[1] // layer.grid_size)
             if pos not in pre_used_pos:
                 pre_used_pos.add(pos)
-                tile_idx = tileset_infos.get_tileset_used_tile_idx(
-                    layer.tileset_def_uid, src
-                )
+                tile_idx = used_tile_idxes[src]
                 if tile_idx >= (1 << 6):
                     bloated = True
                     break
 
         # Actually parse the cells
-        cells: List[int] = [0] * layer.c_wid * layer.c_hei
+        cells = array(CELL_TYPECODES[16 if bloated else 8], [0]) * (
+            layer.c_wid * layer.c_hei
+        )
         for tile in reversed(tiles):
             src = Point(tile.src[0], tile.src[1])
             pos = Point(tile.px[0] // layer.grid_size, tile.px[1] // layer.grid_size)
@@ -1658,9 +2735,7 @@ class LayerAutoLayerTilesCellsHeader(GenPrivHeader):
                 continue
             pos_1 = pos.y * layer.c_wid + pos.x
             if cells[pos_1] == 0:
-                cells[pos_1] = 1 + tileset_infos.get_tileset_used_tile_idx(
-                    layer.tileset_def_uid, src
-                )
+                cells[pos_1] = 1 + used_tile_idxes[src]
                 if bloated:
                     assert 1 <= cells[pos_1] < (1 << 14)
                 else:
@@ -1668,29 +2743,49 @@ class LayerAutoLayerTilesCellsHeader(GenPrivHeader):
                 # Apply flipping
                 cells[pos_1] |= tile.f << (14 if bloated else 6)
 
-        self.cells.append(
-            LayerAutoLayerTilesCellsHeader.CellsInfo(
-                level_ident, layer.identifier, bloated, cells, layer.c_wid
-            )
+        return LayerAutoLayerTilesCellsHeader.CellsInfo(
+            level_ident,
+            layer.identifier,
+            bloated,
+            cells,
+            "" if binary else format_cells_body(cells, layer.c_wid),
         )
 
     @staticmethod
     def tiles_type() -> str:
         return "auto_layer_tiles"
 
-    def _write_contents(self, source: TextIOWrapper):
+    def _level_idents(self) -> List[str]:
+        return list(dict.fromkeys(info.level_ident for info in self.cells))
+
+    def _free_level(self, level_ident: str):
+        super()._free_level(level_ident)
+        self.cells = [info for info in self.cells if info.level_ident != level_ident]
+
+    def _write_level_contents(
+        self, level_ident: str, source: TextIOWrapper, level_includes: List[Path]
+    ):
         for info in self.cells:
-            source.write(
-                f"inline constexpr const std::uint{16 if info.bloated else 8}_t gen_priv_level_{info.level_ident}_layer_{info.layer_ident}_{self.tiles_type()}_cells[] {{"
+            if info.level_ident != level_ident:
+                continue
+
+            self._write_cells(
+                level_ident,
+                source,
+                level_includes,
+                f"std::uint{16 if info.bloated else 8}_t",
+                f"gen_priv_level_{info.level_ident}_layer_{info.layer_ident}_{self.tiles_type()}_cells",
+                info.cells,
+                info.body,
             )
-            for i, cell in enumerate(info.cells):
-                if i % info.width == 0:
-                    source.write("\n    ")
-                source.write(f"{cell}, ")
-            source.write("\n};\n\n")
 
 
-class LayerEntityInstancesHeader(GenPrivHeader):
+class LayerEntityInstancesHeader(ExternDefinitionsHeader, LevelSplitHeader):
+    """
+    With `compact`, the entity instances of every level are in a single project-wide pool in this header.
+    Otherwise, they're split per level.
+    """
+
     class Key(NamedTuple):
         level_ident: str
         layer_ident: str
@@ -1701,17 +2796,29 @@ class LayerEntityInstancesHeader(GenPrivHeader):
         size: Size
         iid: str
         px: Point
+        field_instances_offset: int
 
     @staticmethod
     def base_file_path() -> Path:
         return Path("ldtk_gen_priv_layer_entity_instances.h")
 
-    def __init__(self):
-        super().__init__()
+    def __init__(self, compact: bool = False, extern: bool = False):
+        # Only the compact pool is reachable from the library headers
+        super().__init__(extern and compact)
         self.add_include("ldtk_entity.h")
-        self.add_include("ldtk_gen_priv_entity_definitions.h")
-        self.add_include("ldtk_gen_priv_layer_entity_field_instances.h")
-        self.add_include("ldtk_gen_iids.h")
+
+        self.compact = compact
+        if compact:
+            self.add_definition_include("ldtk_gen_priv_entity_definitions.h")
+            self.add_definition_include("ldtk_gen_priv_layer_entity_field_instances.h")
+            self.add_definition_include("ldtk_gen_iids.h")
+        else:
+            # The entity field instances of the level are included by `add_level_dependency()`
+            self.add_part_include("ldtk_entity.h")
+            self.add_part_include("ldtk_gen_priv_entity_definitions.h")
+            self.add_part_include("ldtk_gen_iids.h")
+
+        self.entity_field_pool_size = 0
 
         self.entities: Dict[
             LayerEntityInstancesHeader.Key, List[LayerEntityInstancesHeader.EntityInfo]
@@ -1732,15 +2839,44 @@ class LayerEntityInstancesHeader(GenPrivHeader):
                     Size(entity.width, entity.height),
                     entity.iid.replace("-", "_"),
                     Point(entity.px[0], entity.px[1]),
+                    # Same order as the entity field pool of the `LayerEntityFieldInstancesHeader`
+                    self.entity_field_pool_size,
                 )
             )
+            self.entity_field_pool_size += len(entity.field_instances)
 
         self.entities[LayerEntityInstancesHeader.Key(level_ident, layer.identifier)] = (
             result
         )
 
+    def splits_levels(self) -> bool:
+        return not self.compact
+
+    def _level_idents(self) -> List[str]:
+        if self.compact:
+            return []
+        return list(dict.fromkeys(key.level_ident for key in self.entities))
+
+    def _free_level(self, level_ident: str):
+        self.entities = {
+            key: entities
+            for key, entities in self.entities.items()
+            if key.level_ident != level_ident
+        }
+
     def _write_contents(self, source: TextIOWrapper):
+        if self.compact:
+            self._write_pool(source)
+        else:
+            super()._write_contents(source)
+
+    def _write_level_contents(
+        self, level_ident: str, source: TextIOWrapper, level_includes: List[Path]
+    ):
         for ident, entities in self.entities.items():
+            if ident.level_ident != level_ident:
+                continue
+
             if len(entities) == 0:
                 source.write(
                     f"inline constexpr bn::span<const entity> gen_priv_level_{ident.level_ident}_layer_{ident.layer_ident}_entities;\n\n"
@@ -1750,19 +2886,295 @@ class LayerEntityInstancesHeader(GenPrivHeader):
                     f"inline constexpr const entity gen_priv_level_{ident.level_ident}_layer_{ident.layer_ident}_entities[] {{\n"
                 )
                 for entity in entities:
-                    source.write("    entity(\n")
-                    source.write(
-                        f"        gen_priv_entity_definitions[{entity.def_idx}],\n"
-                    )
-                    source.write(f"        {entity.grid},\n")
+                    self._write_entity(entity, source)
+                source.write("};\n\n")
+
+    def pool_size(self) -> int:
+        return sum(len(entities) for entities in self.entities.values())
+
+    def has_definitions(self) -> bool:
+        return self.compact and self.pool_size() != 0
+
+    def _write_pool(self, source: TextIOWrapper):
+        """Writes every entity instances into a single project-wide pool, in the insertion order"""
+        if not self.has_definitions():
+            source.write("constexpr auto gen_priv_entity_pool() -> const entity*\n")
+            source.write("{\n")
+            source.write("    return nullptr;\n")
+            source.write("}\n")
+            return
+
+        if self.extern:
+            source.write(
+                f"extern const entity gen_priv_entity_instances[{self.pool_size()}];\n\n"
+            )
+        else:
+            self._write_definitions(source, "inline constexpr")
+
+        source.write("constexpr auto gen_priv_entity_pool() -> const entity*\n")
+        source.write("{\n")
+        source.write("    return gen_priv_entity_instances;\n")
+        source.write("}\n")
+
+    def _write_definitions(self, source: TextIOWrapper, specifier: str):
+        source.write(f"{specifier} const entity gen_priv_entity_instances[] {{\n")
+        for entities in self.entities.values():
+            for entity in entities:
+                self._write_entity(entity, source)
+        source.write("};\n\n")
+
+    def _write_entity(
+        self, entity: "LayerEntityInstancesHeader.EntityInfo", source: TextIOWrapper
+    ):
+        source.write("    entity(\n")
+        source.write(f"        gen_priv_entity_definitions[{entity.def_idx}],\n")
+        source.write(f"        {entity.grid},\n")
+        if self.compact:
+            source.write(f"        {entity.field_instances_offset},\n")
+        else:
+            source.write(f"        gen_priv_entity_{entity.iid}_field_instances,\n")
+        source.write(f"        {entity.size},\n")
+        source.write(f"        entity_iid::_{entity.iid},\n")
+        source.write(f"        {entity.px}\n")
+        source.write("    ),\n")
+
+
+class LayerEntityTablesHeader(LevelSplitHeader):
+    class Key(NamedTuple):
+        level_ident: str
+        layer_ident: str
+
+    class TableInfo(NamedTuple):
+        entity_idents: List[str]
+        px_xs: List[int]
+        px_ys: List[int]
+        widths: List[int]
+        heights: List[int]
+        field_offsets: List[int]
+        entity_instances_offset: int
+
+    @staticmethod
+    def base_file_path() -> Path:
+        return Path("ldtk_gen_priv_layer_entity_tables.h")
+
+    def __init__(self, enabled: bool = False, compact: bool = False):
+        super().__init__()
+        # The entities of the level are included by `add_level_dependency()`
+        self.add_part_include("cstdint", is_system_header=True)
+        self.add_part_include("ldtk_entity_table.h")
+        self.add_part_include("ldtk_gen_idents.h")
+
+        self.enabled = enabled
+        self.compact = compact
+        self.entity_pool_size = 0
+        self.entity_field_pool_size = 0
+        self.level_entity_field_pool_sizes: Dict[str, int] = {}
+        """Level identifier -> Size of the entity field pool of the level, without `compact`"""
+
+        self.tables: Dict[
+            LayerEntityTablesHeader.Key, LayerEntityTablesHeader.TableInfo
+        ] = {}
+
+    def add_table(
+        self,
+        level_ident: str,
+        layer: LdtkJson.LayerInstance,
+        entity_def_lut: Dict[int, LdtkJson.EntityDefinition],
+    ):
+        entities = layer.entity_instances
+        field_offsets: List[int] = []
+        # Same order as the project-wide (`compact`) or level entity field pool of the `LayerEntityFieldInstancesHeader`
+        level_field_pool_size = self.level_entity_field_pool_sizes.get(level_ident, 0)
+        for entity in entities:
+            if self.compact:
+                field_offsets.append(self.entity_field_pool_size)
+            else:
+                field_offsets.append(level_field_pool_size)
+            self.entity_field_pool_size += len(entity.field_instances)
+            level_field_pool_size += len(entity.field_instances)
+        self.level_entity_field_pool_sizes[level_ident] = level_field_pool_size
+
+        self.tables[LayerEntityTablesHeader.Key(level_ident, layer.identifier)] = (
+            LayerEntityTablesHeader.TableInfo(
+                [entity_def_lut[entity.def_uid].identifier for entity in entities],
+                [entity.px[0] for entity in entities],
+                [entity.px[1] for entity in entities],
+                [entity.width for entity in entities],
+                [entity.height for entity in entities],
+                field_offsets,
+                # Same order as the entity pool of the `LayerEntityInstancesHeader`
+                self.entity_pool_size,
+            )
+        )
+        self.entity_pool_size += len(entities)
+
+    def _level_idents(self) -> List[str]:
+        if not self.enabled:
+            return []
+        return list(dict.fromkeys(key.level_ident for key in self.tables))
+
+    def _free_level(self, level_ident: str):
+        self.tables = {
+            key: table
+            for key, table in self.tables.items()
+            if key.level_ident != level_ident
+        }
+        self.level_entity_field_pool_sizes.pop(level_ident, None)
+
+    def _write_level_contents(
+        self, level_ident: str, source: TextIOWrapper, level_includes: List[Path]
+    ):
+        for ident, table in self.tables.items():
+            if ident.level_ident != level_ident:
+                continue
+
+            prefix = f"gen_priv_level_{ident.level_ident}_layer_{ident.layer_ident}"
+
+            if len(table.entity_idents) == 0:
+                pointers_count = 7 if self.compact else 8
+                source.write(
+                    f"inline constexpr entity_table {prefix}_entity_table(0{', nullptr' * pointers_count});\n\n"
+                )
+                continue
+
+            def write_column(element_type: str, name: str, values: List[Any]):
+                source.write(
+                    f"inline constexpr const {element_type} {prefix}_entity_{name}[] {{ "
+                )
+                source.write(", ".join(str(value) for value in values))
+                source.write(" };\n")
+
+            write_column("std::int16_t", "px_x", table.px_xs)
+            write_column("std::int16_t", "px_y", table.px_ys)
+            write_column(
+                "entity_ident",
+                "identifiers",
+                [f"entity_ident::{ident}" for ident in table.entity_idents],
+            )
+            write_column("std::uint16_t", "widths", table.widths)
+            write_column("std::uint16_t", "heights", table.heights)
+            write_column("std::uint16_t", "field_offsets", table.field_offsets)
+
+            source.write(f"\ninline constexpr entity_table {prefix}_entity_table(\n")
+            source.write(f"    {len(table.entity_idents)},\n")
+            source.write(f"    {prefix}_entity_px_x,\n")
+            source.write(f"    {prefix}_entity_px_y,\n")
+            source.write(f"    {prefix}_entity_identifiers,\n")
+            source.write(f"    {prefix}_entity_widths,\n")
+            source.write(f"    {prefix}_entity_heights,\n")
+            source.write(f"    {prefix}_entity_field_offsets,\n")
+            if self.compact:
+                source.write(
+                    f"    gen_priv_entity_instances + {table.entity_instances_offset}\n"
+                )
+            else:
+                has_field_pool = (
+                    self.level_entity_field_pool_sizes[ident.level_ident] != 0
+                )
+                source.write(
+                    f"    {f'gen_priv_level_{ident.level_ident}_entity_field_pool' if has_field_pool else 'nullptr'},\n"
+                )
+                source.write(f"    {prefix}_entities\n")
+            source.write(");\n\n")
+
+
+class LayerEntityTagIndexHeader(LevelSplitHeader):
+    class Key(NamedTuple):
+        level_ident: str
+        layer_ident: str
+
+    @staticmethod
+    def base_file_path() -> Path:
+        return Path("ldtk_gen_priv_layer_entity_tag_index.h")
+
+    def __init__(
+        self,
+        entity_defs: List[LdtkJson.EntityDefinition],
+        enabled: bool = False,
+        compact: bool = False,
+    ):
+        super().__init__()
+        # The entities of the level are included by `add_level_dependency()`
+        self.add_part_include("bn_span.h", is_system_header=True)
+        self.add_part_include("ldtk_entity.h")
+
+        self.enabled = enabled
+        self.compact = compact
+        self.entity_pool_size = 0
+
+        # Same order as the `entity_tag` enum of the `TagsHeader`
+        self.entity_tags: List[str] = sorted(
+            set(tag for entity_def in entity_defs for tag in entity_def.tags)
+        )
+
+        self.tagged_entities: Dict[
+            LayerEntityTagIndexHeader.Key, Dict[str, List[str]]
+        ] = {}
+        """Layer key -> Entity tag -> List[entity pointer expression]"""
+
+    def has_index(self) -> bool:
+        return self.enabled and len(self.entity_tags) != 0
+
+    def add_layer(
+        self,
+        level_ident: str,
+        layer: LdtkJson.LayerInstance,
+        entity_def_lut: Dict[int, LdtkJson.EntityDefinition],
+    ):
+        result: Dict[str, List[str]] = {tag: [] for tag in self.entity_tags}
+        for entity_idx, entity in enumerate(layer.entity_instances):
+            # Same order as the entity pool of the `LayerEntityInstancesHeader`
+            pointer = (
+                f"gen_priv_entity_instances + {self.entity_pool_size + entity_idx}"
+                if self.compact
+                else f"&gen_priv_level_{level_ident}_layer_{layer.identifier}_entities[{entity_idx}]"
+            )
+            for tag in entity_def_lut[entity.def_uid].tags:
+                result[tag].append(pointer)
+        self.entity_pool_size += len(layer.entity_instances)
+
+        self.tagged_entities[
+            LayerEntityTagIndexHeader.Key(level_ident, layer.identifier)
+        ] = result
+
+    def _level_idents(self) -> List[str]:
+        if not self.has_index():
+            return []
+        return list(dict.fromkeys(key.level_ident for key in self.tagged_entities))
+
+    def _free_level(self, level_ident: str):
+        self.tagged_entities = {
+            key: tagged_entities
+            for key, tagged_entities in self.tagged_entities.items()
+            if key.level_ident != level_ident
+        }
+
+    def _write_level_contents(
+        self, level_ident: str, source: TextIOWrapper, level_includes: List[Path]
+    ):
+        for ident, tagged_entities in self.tagged_entities.items():
+            if ident.level_ident != level_ident:
+                continue
+
+            prefix = f"gen_priv_level_{ident.level_ident}_layer_{ident.layer_ident}"
+
+            for tag, pointers in tagged_entities.items():
+                if len(pointers) != 0:
                     source.write(
-                        f"        gen_priv_entity_{entity.iid}_field_instances,\n"
+                        f"inline constexpr const entity* const {prefix}_entities_tagged_{tag}[] {{ "
                     )
-                    source.write(f"        {entity.size},\n")
-                    source.write(f"        entity_iid::_{entity.iid},\n")
-                    source.write(f"        {entity.px}\n")
-                    source.write("    ),\n")
-                source.write("};\n\n")
+                    source.write(", ".join(pointers))
+                    source.write(" };\n")
+
+            source.write(
+                f"inline constexpr const bn::span<const entity* const> {prefix}_entity_tag_index[] {{\n"
+            )
+            for tag, pointers in tagged_entities.items():
+                if len(pointers) != 0:
+                    source.write(f"    {prefix}_entities_tagged_{tag},\n")
+                else:
+                    source.write("    bn::span<const entity* const>(),\n")
+            source.write("};\n\n")
 
 
 class LayerEntityFieldInstancesHeader(LevelFieldInstancesHeader):
@@ -1774,8 +3186,10 @@ class LayerEntityFieldInstancesHeader(LevelFieldInstancesHeader):
     def parent_type() -> str:
         return "entity"
 
-    def __init__(self):
-        super().__init__()
+    def __init__(self, compact: bool = False, extern: bool = False):
+        super().__init__(compact, extern)
+        # Only referenced by the entities of the level, so they stay in the part headers even with `extern`
+        self.extern_definitions = False
 
         self.entity_ident_lut: Dict[str, str] = {}
         """Entity iid (parent id) -> Entity identifier"""
@@ -1783,6 +3197,36 @@ class LayerEntityFieldInstancesHeader(LevelFieldInstancesHeader):
     def add_entity_iid_identifier_mapping(self, entity_iid: str, entity_ident: str):
         self.entity_ident_lut[entity_iid] = entity_ident
 
+    def _write_level_contents(
+        self, level_ident: str, source: TextIOWrapper, level_includes: List[Path]
+    ):
+        # Every entity field of the level in a single pool, so that the `entity_table` can refer to them by offsets
+        parent_ids = self._level_parent_ids(level_ident)
+        pool_name = f"gen_priv_level_{level_ident}_entity_field_pool"
+        if any(len(self.fields[parent_id]) != 0 for parent_id in parent_ids):
+            source.write(f"inline constexpr const field {pool_name}[] {{\n")
+            for parent_id in parent_ids:
+                for field_idx, field in enumerate(self.fields[parent_id]):
+                    source.write("    field(\n")
+                    self._write_definition(field_idx, parent_id, source)
+                    source.write(f"        {field}\n")
+                    source.write("    ),\n")
+            source.write("};\n\n")
+
+        # Same order as the field offsets of the `LayerEntityTablesHeader`
+        offset = 0
+        for parent_id in parent_ids:
+            fields_count = len(self.fields[parent_id])
+            if fields_count == 0:
+                source.write(
+                    f"inline constexpr bn::span<const field> {self._field_instances_name(parent_id)};\n\n"
+                )
+            else:
+                source.write(
+                    f"inline constexpr bn::span<const field> {self._field_instances_name(parent_id)}({pool_name} + {offset}, {fields_count});\n\n"
+                )
+            offset += fields_count
+
     def _write_definition(self, field_idx: int, parent_id: str, source: TextIOWrapper):
         source.write(
             f"        gen_priv_{self.parent_type()}_{self.entity_ident_lut[parent_id]}_field_definitions[{field_idx}],\n"
@@ -1817,15 +3261,15 @@ class LayerGridTilesCellsHeader(LayerAutoLayerTilesCellsHeader):
     def base_file_path() -> Path:
         return Path("ldtk_gen_priv_layer_grid_tiles_cells.h")
 
-    def __init__(self):
-        super().__init__()
+    def __init__(self, interner: Optional[ArrayInterner] = None, binary: bool = False):
+        super().__init__(interner, binary)
 
     @staticmethod
     def tiles_type() -> str:
         return "grid_tiles"
 
 
-class LayerIntGridsHeader(GenPrivHeader):
+class LayerIntGridsHeader(LevelSplitHeader):
     class GridInfo(NamedTuple):
         level_ident: str
         layer_ident: str
@@ -1839,10 +3283,10 @@ class LayerIntGridsHeader(GenPrivHeader):
 
     def __init__(self):
         super().__init__()
-        self.add_include("type_traits", is_system_header=True)
-        self.add_include("ldtk_int_grid_t.h")
-        self.add_include("ldtk_int_grid_empty_t.h")
-        self.add_include("ldtk_gen_priv_layer_int_grid_cells.h")
+        # The cells of the level are included by `add_level_dependency()`
+        self.add_part_include("type_traits", is_system_header=True)
+        self.add_part_include("ldtk_int_grid_t.h")
+        self.add_part_include("ldtk_int_grid_empty_t.h")
 
         self.grids: List[LayerIntGridsHeader.GridInfo] = []
 
@@ -1853,8 +3297,19 @@ class LayerIntGridsHeader(GenPrivHeader):
             )
         )
 
-    def _write_contents(self, source: TextIOWrapper):
+    def _level_idents(self) -> List[str]:
+        return list(dict.fromkeys(grid.level_ident for grid in self.grids))
+
+    def _free_level(self, level_ident: str):
+        self.grids = [grid for grid in self.grids if grid.level_ident != level_ident]
+
+    def _write_level_contents(
+        self, level_ident: str, source: TextIOWrapper, level_includes: List[Path]
+    ):
         for grid in self.grids:
+            if grid.level_ident != level_ident:
+                continue
+
             grid_ident = (
                 f"gen_priv_level_{grid.level_ident}_layer_{grid.layer_ident}_int_grid"
             )
@@ -1867,7 +3322,7 @@ class LayerIntGridsHeader(GenPrivHeader):
                 source.write(");\n\n")
             else:
                 source.write(
-                    f"inline constexpr const int_grid_t<std::remove_cvref_t<std::remove_extent_t<decltype({cells_ident})>>> {grid_ident}(\n"
+                    f"inline constexpr const int_grid_t<std::remove_cvref_t<std::remove_extent_t<std::remove_reference_t<decltype({cells_ident})>>>> {grid_ident}(\n"
                 )
                 source.write(f"    {grid.width},\n")
                 source.write(f"    {grid.height},\n")
@@ -1875,50 +3330,67 @@ class LayerIntGridsHeader(GenPrivHeader):
                 source.write(");\n\n")
 
 
-class LayerIntGridCellsHeader(GenPrivHeader):
+class LayerIntGridCellsHeader(LayerCellsHeader):
     class CellsInfo(NamedTuple):
         level_ident: str
         layer_ident: str
         cell_bits: int
-        cells: List[int]
-        width: int
+        cells: "array[int]"
+        body: str
+        """Pre-formatted cells, so that it can be done in parallel"""
 
     @staticmethod
     def base_file_path() -> Path:
         return Path("ldtk_gen_priv_layer_int_grid_cells.h")
 
-    def __init__(self):
-        super().__init__()
-        self.add_include("cstdint", is_system_header=True)
+    def __init__(self, interner: Optional[ArrayInterner] = None, binary: bool = False):
+        super().__init__(interner, binary)
 
         self.grids: List[LayerIntGridCellsHeader.CellsInfo] = []
 
-    def add_cells(self, level_ident: str, layer: LdtkJson.LayerInstance):
+    def add_cells_info(self, info: "LayerIntGridCellsHeader.CellsInfo"):
+        self.grids.append(info)
+
+    @staticmethod
+    def parse_cells(
+        level_ident: str, layer: LdtkJson.LayerInstance, binary: bool = False
+    ) -> "LayerIntGridCellsHeader.CellsInfo":
+        """Doesn't touch any header state, so that it can be run in a worker process"""
         # Determine cell storage type
         max_cell = max(layer.int_grid_csv)
         cell_bits = 32 if max_cell >= (1 << 16) else 16 if max_cell >= (1 << 8) else 8
 
-        # Actually store the cells
-        self.grids.append(
-            LayerIntGridCellsHeader.CellsInfo(
-                level_ident,
-                layer.identifier,
-                cell_bits,
-                layer.int_grid_csv,
-                layer.c_wid,
-            )
+        return LayerIntGridCellsHeader.CellsInfo(
+            level_ident,
+            layer.identifier,
+            cell_bits,
+            array(CELL_TYPECODES[cell_bits], layer.int_grid_csv),
+            "" if binary else format_cells_body(layer.int_grid_csv, layer.c_wid),
         )
 
-    def _write_contents(self, source: TextIOWrapper):
+    def _level_idents(self) -> List[str]:
+        return list(dict.fromkeys(grid.level_ident for grid in self.grids))
+
+    def _free_level(self, level_ident: str):
+        super()._free_level(level_ident)
+        self.grids = [grid for grid in self.grids if grid.level_ident != level_ident]
+
+    def _write_level_contents(
+        self, level_ident: str, source: TextIOWrapper, level_includes: List[Path]
+    ):
         for grid in self.grids:
-            source.write(
-                f"inline constexpr const std::uint{grid.cell_bits}_t gen_priv_level_{grid.level_ident}_layer_{grid.layer_ident}_int_grid_cells[] {{"
+            if grid.level_ident != level_ident:
+                continue
+
+            self._write_cells(
+                level_ident,
+                source,
+                level_includes,
+                f"std::uint{grid.cell_bits}_t",
+                f"gen_priv_level_{grid.level_ident}_layer_{grid.layer_ident}_int_grid_cells",
+                grid.cells,
+                grid.body,
             )
-            for i, cell in enumerate(grid.cells):
-                if i % grid.width == 0:
-                    source.write("\n    ")
-                source.write(f"{cell}, ")
-            source.write("\n};\n\n")
 
 
 class ProjectHeader(GenHeader):
@@ -1945,3 +3417,245 @@ class ProjectHeader(GenHeader):
         source.write(f"    {self.bg_color},\n")
         source.write(f"    bn::fixed({self.opacity})")
         source.write(");\n")
+
+
+class StatsHeader(GenHeader):
+    """
+    Maxima over all the levels, so that the games can size their containers exactly,
+    without scanning `gen_project.levels()` in constexpr.
+    """
+
+    @staticmethod
+    def base_file_path() -> Path:
+        return Path("ldtk_gen_stats.h")
+
+    @staticmethod
+    def _sub_namespace() -> str:
+        return "::gen::stats"
+
+    def __init__(
+        self,
+        layer_defs: List[LdtkJson.LayerDefinition],
+        entity_defs: List[LdtkJson.EntityDefinition],
+    ):
+        super().__init__()
+        self.add_include("ldtk_gen_idents.h")
+
+        self.layer_idents: List[str] = [layer.identifier for layer in layer_defs]
+        self.entity_idents: List[str] = [entity.identifier for entity in entity_defs]
+
+        self.levels_count = 0
+        self.max_level_px_width = 0
+        self.max_level_px_height = 0
+        self.max_bg_layers_per_level = 0
+        self.max_entities_per_level: DefaultDict[str, int] = DefaultDict(int)
+        """Entity identifier -> Max count in a level"""
+        self.max_entities_per_layer: DefaultDict[str, int] = DefaultDict(int)
+        """Layer identifier -> Max count of all the entities in a layer instance"""
+        self.max_entities_per_layer_entity: DefaultDict[Tuple[str, str], int] = (
+            DefaultDict(int)
+        )
+        """(Layer identifier, Entity identifier) -> Max count in a layer instance"""
+        self.max_tile_cell_bytes: DefaultDict[str, int] = DefaultDict(int)
+        """Layer identifier -> Max bytes of a tiles cell"""
+        self.max_int_grid_cell_bytes: DefaultDict[str, int] = DefaultDict(int)
+        """Layer identifier -> Max bytes of an IntGrid cell"""
+        self.max_int_grid_value: DefaultDict[str, int] = DefaultDict(int)
+        """Layer identifier -> Max IntGrid value"""
+
+    def add_level(
+        self,
+        level: LdtkJson.Level,
+        tile_cells_bloated: List[Optional[bool]],
+        int_grid_cell_bits: List[Optional[int]],
+    ):
+        """
+        `tile_cells_bloated` & `int_grid_cell_bits` are of each layer instance,
+        `None` if it has no visible tiles or no IntGrid cells.
+        """
+        assert level.layer_instances is not None
+        self.levels_count += 1
+        self.max_level_px_width = max(self.max_level_px_width, level.px_wid)
+        self.max_level_px_height = max(self.max_level_px_height, level.px_hei)
+        self.max_bg_layers_per_level = max(
+            self.max_bg_layers_per_level,
+            sum(bloated is not None for bloated in tile_cells_bloated),
+        )
+
+        level_entities: DefaultDict[str, int] = DefaultDict(int)
+        for layer, bloated, cell_bits in zip(
+            level.layer_instances, tile_cells_bloated, int_grid_cell_bits
+        ):
+            ident = layer.identifier
+            layer_entities: DefaultDict[str, int] = DefaultDict(int)
+            for entity in layer.entity_instances:
+                layer_entities[entity.identifier] += 1
+                level_entities[entity.identifier] += 1
+            for entity_ident, count in layer_entities.items():
+                key = (ident, entity_ident)
+                self.max_entities_per_layer_entity[key] = max(
+                    self.max_entities_per_layer_entity[key], count
+                )
+            self.max_entities_per_layer[ident] = max(
+                self.max_entities_per_layer[ident], len(layer.entity_instances)
+            )
+
+            if bloated is not None:
+                self.max_tile_cell_bytes[ident] = max(
+                    self.max_tile_cell_bytes[ident], 2 if bloated else 1
+                )
+            if cell_bits is not None:
+                self.max_int_grid_cell_bytes[ident] = max(
+                    self.max_int_grid_cell_bytes[ident], cell_bits // 8
+                )
+            if layer.int_grid_csv:
+                self.max_int_grid_value[ident] = max(
+                    self.max_int_grid_value[ident], max(layer.int_grid_csv)
+                )
+
+        for entity_ident, count in level_entities.items():
+            self.max_entities_per_level[entity_ident] = max(
+                self.max_entities_per_level[entity_ident], count
+            )
+
+    @staticmethod
+    def _write_switch(
+        source: TextIOWrapper,
+        indent: str,
+        variable: str,
+        enum_name: str,
+        cases: List[Tuple[str, str]],
+    ):
+        """`cases` are (Enumerator, Statements); The others return `0`"""
+        source.write(f"{indent}switch ({variable})\n")
+        source.write(f"{indent}{{\n")
+        for enumerator, statements in cases:
+            source.write(f"{indent}case {enum_name}::{enumerator}:\n")
+            source.write(statements)
+        source.write(f"{indent}default:\n")
+        source.write(f"{indent}    return 0;\n")
+        source.write(f"{indent}}}\n")
+
+    def _write_layer_function(
+        self, source: TextIOWrapper, brief: str, name: str, values: Dict[str, int]
+    ):
+        source.write(f"/// @brief {brief}\n")
+        source.write(
+            f"[[nodiscard]] constexpr auto {name}(layer_ident layer_identifier) -> int\n"
+        )
+        source.write("{\n")
+        self._write_switch(
+            source,
+            "    ",
+            "layer_identifier",
+            "layer_ident",
+            [
+                (ident, f"        return {values[ident]};\n")
+                for ident in self.layer_idents
+                if values.get(ident, 0) != 0
+            ],
+        )
+        source.write("}\n")
+
+    def _write_contents(self, source: TextIOWrapper):
+        source.write("/// @brief Number of the levels.\n")
+        source.write(f"inline constexpr int levels_count = {self.levels_count};\n\n")
+        source.write("/// @brief Max pixel width of the levels.\n")
+        source.write(
+            f"inline constexpr int max_level_px_width = {self.max_level_px_width};\n\n"
+        )
+        source.write("/// @brief Max pixel height of the levels.\n")
+        source.write(
+            f"inline constexpr int max_level_px_height = {self.max_level_px_height};\n\n"
+        )
+        source.write(
+            "/// @brief Max layers with visible tiles in a level, "
+            "i.e. backgrounds of an `ldtk::level_bgs_ptr`.\n"
+        )
+        source.write(
+            f"inline constexpr int max_bg_layers_per_level = {self.max_bg_layers_per_level};\n\n"
+        )
+
+        source.write("/// @brief Max entities of the identifier in a level.\n")
+        source.write(
+            "[[nodiscard]] constexpr auto max_entities_per_level(entity_ident entity_identifier) -> int\n"
+        )
+        source.write("{\n")
+        self._write_switch(
+            source,
+            "    ",
+            "entity_identifier",
+            "entity_ident",
+            [
+                (ident, f"        return {self.max_entities_per_level[ident]};\n")
+                for ident in self.entity_idents
+                if self.max_entities_per_level.get(ident, 0) != 0
+            ],
+        )
+        source.write("}\n\n")
+
+        self._write_layer_function(
+            source,
+            "Max entities in a layer instance of the identifier.",
+            "max_entities_per_layer",
+            self.max_entities_per_layer,
+        )
+        source.write("\n")
+
+        source.write(
+            "/// @brief Max entities of the entity identifier in a layer instance of the layer identifier.\n"
+        )
+        source.write(
+            "[[nodiscard]] constexpr auto max_entities_per_layer(layer_ident layer_identifier, "
+            "entity_ident entity_identifier) -> int\n"
+        )
+        source.write("{\n")
+        layer_cases: List[Tuple[str, str]] = []
+        for layer_ident in self.layer_idents:
+            entity_cases = [
+                (
+                    entity_ident,
+                    f"            return {self.max_entities_per_layer_entity[(layer_ident, entity_ident)]};\n",
+                )
+                for entity_ident in self.entity_idents
+                if self.max_entities_per_layer_entity.get(
+                    (layer_ident, entity_ident), 0
+                )
+                != 0
+            ]
+            if entity_cases:
+                statements = StringIO()
+                self._write_switch(
+                    statements,
+                    "        ",
+                    "entity_identifier",
+                    "entity_ident",
+                    entity_cases,
+                )
+                layer_cases.append((layer_ident, statements.getvalue()))
+        self._write_switch(
+            source, "    ", "layer_identifier", "layer_ident", layer_cases
+        )
+        source.write("}\n\n")
+
+        self._write_layer_function(
+            source,
+            "Max bytes of a visible tiles cell in a layer instance of the identifier (`1` or `2`), "
+            "or `0` if none has visible tiles.",
+            "max_tile_cell_bytes",
+            self.max_tile_cell_bytes,
+        )
+        source.write("\n")
+        self._write_layer_function(
+            source,
+            "Max bytes of an IntGrid cell in a layer instance of the identifier, or `0` if none has IntGrid cells.",
+            "max_int_grid_cell_bytes",
+            self.max_int_grid_cell_bytes,
+        )
+        source.write("\n")
+        self._write_layer_function(
+            source,
+            "Max IntGrid value in a layer instance of the identifier, or `0` if none has IntGrid cells.",
+            "max_int_grid_value",
+            self.max_int_grid_value,
+        )
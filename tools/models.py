@@ -2,7 +2,7 @@
 # SPDX-License-Identifier: Zlib
 
 import LdtkJson
-from typing import Final, Optional, List, Dict, Set, NamedTuple
+from typing import Final, Optional, List, Dict, FrozenSet, Set, NamedTuple
 from PIL import ImageColor
 from math import floor
 
@@ -189,12 +189,15 @@ class TilesetInfos:
         tilesets_used_tiles: List[Set[Point]] = [
             set() for _ in range(len(ldtk_project.defs.tilesets))
         ]
+        # Level identifier -> Tileset index -> Set of used tiles in the level (src points)
+        levels_used_tiles: Dict[str, Dict[int, Set[Point]]] = {}
 
         for level in ldtk_project.levels:
             if level.layer_instances is None:
                 raise AssertionError(
                     f'Level "{level.identifier}" does not have layer_instances'
                 )
+            level_used_tiles = levels_used_tiles.setdefault(level.identifier, {})
             for layer in level.layer_instances:
                 # To skip overlapped tiles in the same grid pos
                 overlapped_pos: Set[Point] = set()
@@ -206,9 +209,12 @@ class TilesetInfos:
                     assert layer.tileset_def_uid is not None
                     if layer.tileset_def_uid not in tileset_uid_to_idx:
                         continue
-                    used_tiles: Set[Point] = tilesets_used_tiles[
-                        tileset_uid_to_idx[layer.tileset_def_uid]
-                    ]
+                    tileset_idx = tileset_uid_to_idx[layer.tileset_def_uid]
+                    used_tiles: Set[Point] = tilesets_used_tiles[tileset_idx]
+                    # Even if all of them are out of bound, the layer still uses the tileset
+                    level_tileset_used_tiles = level_used_tiles.setdefault(
+                        tileset_idx, set()
+                    )
                     # Reversed to use skip overlapping tile behind the same px pos
                     for tile in reversed(tiles):
                         pos: Point = Point(
@@ -225,6 +231,9 @@ class TilesetInfos:
                         if pos not in overlapped_pos:
                             overlapped_pos.add(pos)
                             used_tiles.add(Point(tile.src[0], tile.src[1]))
+                            level_tileset_used_tiles.add(
+                                Point(tile.src[0], tile.src[1])
+                            )
 
         self.__tileset_uid_to_idx: Dict[int, int] = tileset_uid_to_idx
         self.__tileset_idx_to_def: Dict[int, LdtkJson.TilesetDefinition] = (
@@ -237,6 +246,15 @@ class TilesetInfos:
         self.__used_tile_srcs: List[List[Point]] = [
             list(srcs) for srcs in tilesets_used_tiles
         ]
+        self.__levels_used_tile_idxes: Dict[str, Dict[int, List[int]]] = {
+            level_ident: {
+                tileset_idx: sorted(
+                    self.__used_tile_idxes[tileset_idx][src] for src in srcs
+                )
+                for tileset_idx, srcs in level_used_tiles.items()
+            }
+            for level_ident, level_used_tiles in levels_used_tiles.items()
+        }
 
     def get_tileset_idx(self, tileset_uid: int) -> int:
         return self.__tileset_uid_to_idx[tileset_uid]
@@ -247,9 +265,23 @@ class TilesetInfos:
     def get_tileset_used_tiles_count(self, tileset_uid: int) -> int:
         return len(self.__used_tile_idxes[self.get_tileset_idx(tileset_uid)])
 
+    def get_tileset_used_tile_idxes(self, tileset_uid: int) -> Dict[Point, int]:
+        return self.__used_tile_idxes[self.get_tileset_idx(tileset_uid)]
+
     def get_tileset_used_tile_idx(self, tileset_uid: int, tile_src: Point) -> int:
         return self.__used_tile_idxes[self.get_tileset_idx(tileset_uid)][tile_src]
 
+    def get_level_tileset_used_tile_idxes(
+        self, level_ident: str, tileset_uid: int
+    ) -> Optional[List[int]]:
+        """
+        Sorted indexes of the used tiles of the tileset, which are used in the level.
+        Returns `None` if no tile layer of the level uses the tileset.
+        """
+        return self.__levels_used_tile_idxes[level_ident].get(
+            self.get_tileset_idx(tileset_uid)
+        )
+
     def get_tileset_is_used_tile_id(self, tileset_uid: int, tile_id: int):
         tile_src = self.__get_tile_src(tileset_uid, tile_id)
         return tile_src in self.__used_tile_idxes[self.get_tileset_idx(tileset_uid)]
@@ -270,3 +302,129 @@ class TilesetInfos:
             tileset_def.padding + grid_x * square_diff,
             tileset_def.padding + grid_y * square_diff,
         )
+
+
+class TileCell(NamedTuple):
+    tile_idx: int
+    x_flip: bool
+    y_flip: bool
+
+
+class DeduplicatedTiles(NamedTuple):
+    tiles: List[bytes]
+    """Unique 8x8 tiles"""
+    cells: List[TileCell]
+    """Cell of each 8x8 tile passed to `deduplicate_tiles()`, in the same order"""
+
+
+def flip_tile(tile: bytes, x_flip: bool, y_flip: bool) -> bytes:
+    """Flips an 8x8 tile of a byte per pixel"""
+    rows = [tile[y : y + 8] for y in range(0, 64, 8)]
+    if y_flip:
+        rows.reverse()
+    if x_flip:
+        rows = [row[::-1] for row in rows]
+    return b"".join(rows)
+
+
+def deduplicate_tiles(tiles: List[bytes]) -> DeduplicatedTiles:
+    """
+    Deduplicates the 8x8 tiles of a byte per pixel,
+    recognizing the horizontally and/or vertically flipped duplicates as well.
+    The first occurrence becomes the unique tile, so the result is deterministic.
+    """
+    unique_tiles: List[bytes] = []
+    unique_tile_idxes: Dict[bytes, int] = {}
+    cells: List[TileCell] = []
+
+    for tile in tiles:
+        tile_idx = unique_tile_idxes.get(tile)
+        if tile_idx is not None:
+            cells.append(TileCell(tile_idx, False, False))
+            continue
+
+        # If the flipped tile is a unique tile, this tile is that unique tile flipped back
+        for x_flip, y_flip in ((True, False), (False, True), (True, True)):
+            tile_idx = unique_tile_idxes.get(flip_tile(tile, x_flip, y_flip))
+            if tile_idx is not None:
+                cells.append(TileCell(tile_idx, x_flip, y_flip))
+                break
+        else:
+            unique_tile_idxes[tile] = len(unique_tiles)
+            cells.append(TileCell(len(unique_tiles), False, False))
+            unique_tiles.append(tile)
+
+    return DeduplicatedTiles(unique_tiles, cells)
+
+
+MAX_SUB_PALETTES_COUNT: Final[int] = 16
+MAX_SUB_PALETTE_COLORS_COUNT: Final[int] = 15
+"""Color 0 of a 4bpp sub-palette is transparent"""
+
+
+class PackedSubPalettes(NamedTuple):
+    palettes: List[List[int]]
+    """Sorted colors of each sub-palette, without the transparent one"""
+    tile_palette_idxes: List[int]
+    """Sub-palette index of each tile passed to `pack_sub_palettes()`, in the same order"""
+
+
+def pack_sub_palettes(tile_colors: List[FrozenSet[int]]) -> Optional[PackedSubPalettes]:
+    """
+    Packs the opaque colors of the 8x8 tiles into as few 4bpp sub-palettes as it can,
+    so that all the colors of a tile are in a single sub-palette.
+
+    Greedy bin-packing: The biggest color sets go first, each into the sub-palette which grows the least,
+    and then the sub-palettes which fit together are merged.
+    Ties are broken with the order, so the result is deterministic.
+
+    Returns `None` if a tile has too many colors, or the colors don't fit in 16 sub-palettes.
+    """
+    color_sets = sorted(
+        set(tile_colors), key=lambda colors: (-len(colors), sorted(colors))
+    )
+
+    palettes: List[Set[int]] = []
+    for colors in color_sets:
+        if len(colors) > MAX_SUB_PALETTE_COLORS_COUNT:
+            return None
+
+        best_palette: Optional[Set[int]] = None
+        best_growth = MAX_SUB_PALETTE_COLORS_COUNT + 1
+        for palette in palettes:
+            growth = len(colors - palette)
+            if (
+                growth < best_growth
+                and len(palette) + growth <= MAX_SUB_PALETTE_COLORS_COUNT
+            ):
+                best_palette, best_growth = palette, growth
+
+        if best_palette is None:
+            palettes.append(set(colors))
+        else:
+            best_palette |= colors
+
+    merged = True
+    while merged:
+        merged = False
+        for i, j in (
+            (i, j) for i in range(len(palettes)) for j in range(i + 1, len(palettes))
+        ):
+            if len(palettes[i] | palettes[j]) <= MAX_SUB_PALETTE_COLORS_COUNT:
+                palettes[i] |= palettes.pop(j)
+                merged = True
+                break
+
+    if len(palettes) > MAX_SUB_PALETTES_COUNT:
+        return None
+
+    if not palettes:
+        palettes.append(set())
+
+    tile_palette_idxes = [
+        next(idx for idx, palette in enumerate(palettes) if colors <= palette)
+        for colors in tile_colors
+    ]
+    return PackedSubPalettes(
+        [sorted(palette) for palette in palettes], tile_palette_idxes
+    )
@@ -0,0 +1,155 @@
+# SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+# SPDX-License-Identifier: Zlib
+
+from pathlib import Path
+from typing import Any, Callable, Dict, Iterator, List, Optional, Tuple, TypeVar
+import contextlib
+import json
+import os
+import sys
+import threading
+import time
+import tracemalloc
+
+try:
+    import resource
+except ImportError:  # Windows
+    resource = None
+
+T = TypeVar("T")
+R = TypeVar("R")
+
+
+def max_rss_bytes() -> Optional[int]:
+    """Peak resident set size of this process so far, which also counts the memory outside of Python (e.g. images)"""
+    if resource is None:
+        return None
+    max_rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # Kilobytes on Linux, bytes on macOS
+    return max_rss if sys.platform == "darwin" else max_rss * 1024
+
+
+class _OpenStage:
+    def __init__(self, name: str, category: str, args: Dict[str, Any]):
+        self.name = name
+        self.category = category
+        self.args = args
+        self.begin_us = time.monotonic_ns() // 1000
+        self.begin_traced: int = tracemalloc.get_traced_memory()[0]
+        self.peak_traced: int = self.begin_traced
+
+
+class Profiler:
+    """
+    Records the wall time and the peak memory of the conversion stages,
+    and writes them as a Chrome trace-event JSON (`chrome://tracing`, https://ui.perfetto.dev).
+
+    Peak memory is of the Python allocations traced by `tracemalloc` while the stage is open,
+    so turning it on makes the conversion a few times slower.
+    """
+
+    def __init__(self):
+        self.enabled = False
+        self.__events: List[Dict[str, Any]] = []
+        self.__stack: List[_OpenStage] = []
+
+    def start(self):
+        self.enabled = True
+        self.__events.clear()
+        self.__stack.clear()
+        if not tracemalloc.is_tracing():
+            tracemalloc.start()
+        self.__add_process_name(os.getpid(), "butano_ldtk.py")
+
+    def stop(self):
+        self.enabled = False
+        tracemalloc.stop()
+
+    @contextlib.contextmanager
+    def stage(self, name: str, category: str = "stage", **args: Any) -> Iterator[None]:
+        """Records a stage, which can be nested in another one"""
+        if not self.enabled:
+            yield
+            return
+
+        self.__fold_peak()
+        self.__stack.append(_OpenStage(name, category, args))
+        try:
+            yield
+        finally:
+            self.__fold_peak()
+            stage = self.__stack.pop()
+            self.__events.append(self.__complete_event(stage))
+            if self.__stack:
+                parent = self.__stack[-1]
+                parent.peak_traced = max(parent.peak_traced, stage.peak_traced)
+
+    def pop_event(self) -> Dict[str, Any]:
+        """Takes out the last recorded stage, to send it back from a worker process"""
+        return self.__events.pop()
+
+    def add_event(self, event: Dict[str, Any]):
+        """Adds a stage recorded in a worker process by `run_profiled()`"""
+        if not self.enabled:
+            return
+        pid = event["pid"]
+        if not any(e["ph"] == "M" and e["pid"] == pid for e in self.__events):
+            self.__add_process_name(pid, "worker")
+        self.__events.append(event)
+
+    def write(self, trace_file_path: Path):
+        trace = {"traceEvents": self.__events, "displayTimeUnit": "ms"}
+        trace_file_path.parent.mkdir(parents=True, exist_ok=True)
+        with trace_file_path.open("w", encoding="utf-8") as trace_file:
+            json.dump(trace, trace_file, indent=1)
+
+    def __fold_peak(self):
+        """Folds the peak since the last fold into the open stages, as `tracemalloc` has only one peak"""
+        peak = tracemalloc.get_traced_memory()[1]
+        if self.__stack:
+            self.__stack[-1].peak_traced = max(self.__stack[-1].peak_traced, peak)
+        tracemalloc.reset_peak()
+
+    def __complete_event(self, stage: _OpenStage) -> Dict[str, Any]:
+        end_us = time.monotonic_ns() // 1000
+        end_traced = tracemalloc.get_traced_memory()[0]
+        args = dict(stage.args)
+        args["peak_memory_bytes"] = stage.peak_traced
+        args["memory_delta_bytes"] = end_traced - stage.begin_traced
+        rss = max_rss_bytes()
+        if rss is not None:
+            args["max_rss_bytes"] = rss
+        return {
+            "name": stage.name,
+            "cat": stage.category,
+            "ph": "X",
+            "ts": stage.begin_us,
+            "dur": end_us - stage.begin_us,
+            "pid": os.getpid(),
+            "tid": threading.get_ident(),
+            "args": args,
+        }
+
+    def __add_process_name(self, pid: int, name: str):
+        self.__events.append(
+            {"name": "process_name", "ph": "M", "pid": pid, "args": {"name": name}}
+        )
+
+
+profiler = Profiler()
+"""Profiler of this conversion, only recording when `--profile` is given"""
+
+
+def run_profiled(
+    name: str, category: str, function: Callable[[T], R], item: T
+) -> Tuple[R, Dict[str, Any]]:
+    """
+    Runs `function` on `item` as a stage, and returns its result along with the recorded stage,
+    so that a worker process can send it back to be added with `profiler.add_event()`.
+    """
+    # Forked workers inherit the started profiler, but spawned ones don't
+    if not profiler.enabled:
+        profiler.start()
+    with profiler.stage(name, category):
+        result = function(item)
+    return result, profiler.pop_event()
@@ -0,0 +1,396 @@
+# SPDX-FileCopyrightText: Copyright 2025-2026 Guyeon Yu <copyrat90@gmail.com>
+# SPDX-License-Identifier: Zlib
+
+import LdtkJson
+from gen_sources import ArrayInterner, LevelFieldArraysHeader
+from models import parse_field_type
+from array import array
+from pathlib import Path
+from typing import Any, Dict, Final, List, NamedTuple, Optional, Sequence, Tuple
+import json
+
+SIZE_REPORT_FILE_NAME: Final[str] = "ldtk_gen_size_report"
+"""`.txt` & `.json` in the build folder"""
+
+MULTIBOOT_BYTES: Final[int] = 256 * 1024
+
+OBJECT_SIZES: Final[Dict[str, Tuple[int, int]]] = {
+    "level": (52, 36),
+    "layer": (52, 36),
+    "entity": (40, 20),
+    "field": (24, 16),
+}
+"""`sizeof()` of the object graph on the GBA, without & with `--compact`; Layers without the optional pointers"""
+
+LAYER_OPTIONAL_POINTER_SIZE: Final[int] = 4
+"""Bytes each layer stores for a pointer compiled out without its option (e.g. `--entity-tables`)"""
+
+GRID_OBJECT_SIZE: Final[int] = 20
+"""`sizeof()` of `ldtk::tile_grid_t` & `ldtk::int_grid_t` on the GBA"""
+EMPTY_INT_GRID_OBJECT_SIZE: Final[int] = 12
+"""`sizeof(ldtk::int_grid_empty_t)` on the GBA"""
+
+OPTIONAL_ELEMENT_SIZES: Final[Dict[str, int]] = {
+    "std::uint8_t": 2,
+    "std::int8_t": 2,
+    "std::uint16_t": 4,
+    "std::int16_t": 4,
+    "std::uint32_t": 8,
+    "std::int32_t": 8,
+    "std::uint64_t": 16,
+    "std::int64_t": 16,
+    "bn::fixed": 8,
+    "bn::string_view": 12,
+    "entity_ref": 16,
+    "bn::point": 12,
+}
+"""`sizeof(bn::optional<T>)` on the GBA; Unlisted ones are assumed to be 8 bytes"""
+
+
+def element_size(element_type: str) -> int:
+    if element_type.startswith("bn::optional<"):
+        return OPTIONAL_ELEMENT_SIZES.get(element_type[len("bn::optional<") : -1], 8)
+    return ArrayInterner.ELEMENT_SIZES.get(element_type, 4)
+
+
+def cells_size(cells: Optional["array[int]"]) -> int:
+    return 0 if cells is None else len(cells) * cells.itemsize
+
+
+def lz77_compressed_size(data: bytes) -> int:
+    """
+    Size of `data` compressed with the GBA BIOS LZ77 (VRAM safe), as Butano's `"compression": "lz77"` would.
+
+    Greedy matching, so it's an upper bound of what grit makes.
+    """
+    MIN_MATCH: Final[int] = 3
+    MAX_MATCH: Final[int] = 18
+    WINDOW: Final[int] = 4096
+    MAX_CANDIDATES: Final[int] = 32
+
+    size = 4  # header
+    tokens = 0
+    chains: Dict[bytes, List[int]] = {}
+    pos = 0
+    while pos < len(data):
+        best_length = 0
+        limit = min(MAX_MATCH, len(data) - pos)
+        for candidate in reversed(chains.get(data[pos : pos + MIN_MATCH], [])):
+            if pos - candidate > WINDOW:
+                break
+            # VRAM is written by 16-bit, so the BIOS can't copy from the byte just written
+            if pos - candidate < 2:
+                continue
+            length = MIN_MATCH
+            while length < limit and data[candidate + length] == data[pos + length]:
+                length += 1
+            if length > best_length:
+                best_length = length
+                if length == limit:
+                    break
+
+        step = best_length if best_length >= MIN_MATCH else 1
+        size += 2 if best_length >= MIN_MATCH else 1
+        tokens += 1
+        for start in range(pos, pos + step):
+            chain = chains.setdefault(data[start : start + MIN_MATCH], [])
+            chain.append(start)
+            if len(chain) > MAX_CANDIDATES * 2:
+                del chain[:MAX_CANDIDATES]
+        pos += step
+
+    size += (tokens + 7) // 8  # flag byte per 8 tokens
+    return (size + 3) & ~3
+
+
+class TilesetSizes(NamedTuple):
+    tiles: int
+    palette: int
+    map: int
+    estimated: bool
+    """`True` if left to Butano's graphics tool, which might reduce the tiles & palette further"""
+    lz77_tiles: Optional[int] = None
+    """Tiles compressed with LZ77, if they're written directly (`--direct-bg-items`)"""
+
+
+class LayerSizes(NamedTuple):
+    identifier: str
+    auto_layer_tiles: int
+    grid_tiles: int
+    int_grid: int
+    entities: int
+    entity_fields: int
+    entity_field_arrays: int
+    objects: int
+
+    @property
+    def total(self) -> int:
+        return sum(self[1:])
+
+
+class LevelSizes(NamedTuple):
+    identifier: str
+    fields: int
+    field_arrays: int
+    objects: int
+    layers: List[LayerSizes]
+
+    @property
+    def total(self) -> int:
+        return (
+            self.fields
+            + self.field_arrays
+            + self.objects
+            + sum(layer.total for layer in self.layers)
+        )
+
+
+class SizeReport:
+    """
+    Estimated bytes of the generated data on the GBA, broken down per tileset, level & layer,
+    along with what `--compact` & the LZ77 compression of the tileset tiles would save.
+
+    Arrays are counted before the deduplication of `ArrayInterner`, which is reported separately.
+    """
+
+    def __init__(self, compact: bool, layer_optional_pointers: int = 0):
+        self.compact = compact
+        self.layer_optional_pointers = layer_optional_pointers
+        self.tilesets: Dict[str, TilesetSizes] = {}
+        self.levels: List[LevelSizes] = []
+        self.deduplicated_bytes = 0
+
+        self.__object_counts: Dict[str, int] = {kind: 0 for kind in OBJECT_SIZES}
+
+    def __object_size(self, kind: str, count: int = 1) -> int:
+        self.__object_counts[kind] += count
+        size = OBJECT_SIZES[kind][1 if self.compact else 0]
+        if kind == "layer":
+            size += LAYER_OPTIONAL_POINTER_SIZE * self.layer_optional_pointers
+        return size * count
+
+    @staticmethod
+    def __field_arrays_size(
+        fields: Sequence[LdtkJson.FieldInstance],
+        field_defs: Sequence[LdtkJson.FieldDefinition],
+    ) -> int:
+        """Array elements & the characters of the strings"""
+        size = 0
+        for field, field_def in zip(fields, field_defs):
+            if field.value is None:
+                continue
+            values: List[Any] = field.value if field.type.startswith("Array") else []
+            if values:
+                parsed = parse_field_type(
+                    field.type, field_def.can_be_null, field_def.min, field_def.max
+                )
+                elem_type = LevelFieldArraysHeader.ELEM_TYPE[parsed.field_type]
+                size += len(values) * element_size(elem_type)
+            for value in values or [field.value]:
+                if isinstance(value, str) and "String" in field.type:
+                    size += len(value.encode("utf-8")) + 1
+        return size
+
+    def add_tileset(self, name: str, sizes: TilesetSizes):
+        self.tilesets[name] = sizes
+
+    def add_level(
+        self,
+        level: LdtkJson.Level,
+        layers_cells: Sequence[Tuple[Optional["array[int]"], ...]],
+        level_field_defs: Sequence[LdtkJson.FieldDefinition],
+        entity_def_lut: Dict[int, LdtkJson.EntityDefinition],
+    ):
+        """`layers_cells` are the auto-layer tiles, grid tiles & IntGrid cells of each layer"""
+        assert level.layer_instances is not None
+
+        layers: List[LayerSizes] = []
+        for layer, (auto_cells, grid_cells, int_grid_cells) in zip(
+            level.layer_instances, layers_cells
+        ):
+            objects = self.__object_size("layer")
+            objects += GRID_OBJECT_SIZE * (auto_cells is not None)
+            objects += GRID_OBJECT_SIZE * (grid_cells is not None)
+            if layer.int_grid_csv:
+                objects += (
+                    GRID_OBJECT_SIZE
+                    if int_grid_cells is not None
+                    else EMPTY_INT_GRID_OBJECT_SIZE
+                )
+
+            entity_fields = 0
+            entity_field_arrays = 0
+            for entity in layer.entity_instances:
+                entity_fields += self.__object_size(
+                    "field", len(entity.field_instances)
+                )
+                entity_field_arrays += self.__field_arrays_size(
+                    entity.field_instances, entity_def_lut[entity.def_uid].field_defs
+                )
+
+            layers.append(
+                LayerSizes(
+                    layer.identifier,
+                    cells_size(auto_cells),
+                    cells_size(grid_cells),
+                    cells_size(int_grid_cells),
+                    self.__object_size("entity", len(layer.entity_instances)),
+                    entity_fields,
+                    entity_field_arrays,
+                    objects,
+                )
+            )
+
+        self.levels.append(
+            LevelSizes(
+                level.identifier,
+                self.__object_size("field", len(level.field_instances)),
+                self.__field_arrays_size(level.field_instances, level_field_defs),
+                self.__object_size("level"),
+                layers,
+            )
+        )
+
+    @property
+    def tilesets_total(self) -> int:
+        return sum(t.tiles + t.palette + t.map for t in self.tilesets.values())
+
+    @property
+    def levels_total(self) -> int:
+        return sum(level.total for level in self.levels)
+
+    @property
+    def total(self) -> int:
+        return self.tilesets_total + self.levels_total - self.deduplicated_bytes
+
+    @property
+    def compact_savings(self) -> int:
+        """Bytes `--compact` saves (or would save) on the object graph"""
+        return sum(
+            count * (OBJECT_SIZES[kind][0] - OBJECT_SIZES[kind][1])
+            for kind, count in self.__object_counts.items()
+        )
+
+    @property
+    def lz77_savings(self) -> int:
+        """Bytes the LZ77 compression of the directly written tileset tiles would save"""
+        return sum(
+            t.tiles - t.lz77_tiles
+            for t in self.tilesets.values()
+            if t.lz77_tiles is not None
+        )
+
+    def to_dict(self) -> Dict[str, Any]:
+        return {
+            "compact": self.compact,
+            "total": self.total,
+            "multiboot_bytes": MULTIBOOT_BYTES,
+            "deduplicated_bytes": self.deduplicated_bytes,
+            "savings": {"compact": self.compact_savings, "lz77": self.lz77_savings},
+            "tilesets": [
+                {"name": name, **sizes._asdict()}
+                for name, sizes in self.tilesets.items()
+            ],
+            "levels": [
+                {
+                    "identifier": level.identifier,
+                    "total": level.total,
+                    "fields": level.fields,
+                    "field_arrays": level.field_arrays,
+                    "objects": level.objects,
+                    "layers": [
+                        {**layer._asdict(), "total": layer.total}
+                        for layer in level.layers
+                    ],
+                }
+                for level in self.levels
+            ],
+        }
+
+    def to_text(self) -> str:
+        lines: List[str] = ["Estimated bytes of the generated data on the GBA", ""]
+
+        def row(name: str, name_width: int, values: Sequence[Any], width: int) -> str:
+            return f"{name:<{name_width}}" + "".join(f"{v:>{width}}" for v in values)
+
+        tileset_names = [
+            name + (" (BMP)" if t.estimated else "")
+            for name, t in self.tilesets.items()
+        ]
+        name_width = max([len("Tilesets total"), *map(len, tileset_names)]) + 2
+        lines.append(
+            row(
+                "Tileset",
+                name_width,
+                ["tiles", "palette", "map", "total", "lz77 tiles"],
+                12,
+            )
+        )
+        for name, t in zip(tileset_names, self.tilesets.values()):
+            lz77 = "n/a" if t.lz77_tiles is None else t.lz77_tiles
+            values = [t.tiles, t.palette, t.map, t.tiles + t.palette + t.map, lz77]
+            lines.append(row(name, name_width, values, 12))
+        lines.append(
+            row("Tilesets total", name_width, ["", "", "", self.tilesets_total], 12)
+        )
+        lines.append("")
+
+        level_names = [level.identifier for level in self.levels] + [
+            "  " + layer.identifier for level in self.levels for layer in level.layers
+        ]
+        name_width = max([len("Level / layer"), *map(len, level_names)]) + 2
+        columns = [
+            "auto tiles",
+            "grid tiles",
+            "IntGrid",
+            "entities",
+            "e. fields",
+            "e. arrays",
+            "fields",
+            "arrays",
+            "objects",
+            "total",
+        ]
+        lines.append(row("Level / layer", name_width, columns, 11))
+        for level in self.levels:
+            values = [""] * 6 + [
+                level.fields,
+                level.field_arrays,
+                level.objects,
+                level.total,
+            ]
+            lines.append(row(level.identifier, name_width, values, 11))
+            for layer in level.layers:
+                values = [*layer[1:7], "", "", layer.objects, layer.total]
+                lines.append(row("  " + layer.identifier, name_width, values, 11))
+        lines.append(
+            row("Levels total", name_width, [""] * 9 + [self.levels_total], 11)
+        )
+        lines.append("")
+
+        lines.append(
+            f"Deduplicated arrays: -{self.deduplicated_bytes} bytes (already applied)"
+        )
+        lines.append(
+            f"Total: {self.total} bytes ({self.total * 100 / MULTIBOOT_BYTES:.1f}% of the 256 KiB multiboot limit)"
+        )
+        lines.append("")
+        compact_verb = "saves" if self.compact else "would save"
+        lines.append(
+            f"--compact {compact_verb} {self.compact_savings} bytes of the object graph"
+        )
+        lines.append(
+            f"LZ77 compression of the tileset tiles would save {self.lz77_savings} bytes "
+            "(only counted for --direct-bg-items)"
+        )
+        lines.append(
+            "Level cells & tileset maps are read at random by the level BGs, so they can't be compressed"
+        )
+        return "\n".join(lines) + "\n"
+
+    def write(self, build_folder_path: Path):
+        """Not tracked as a built file, so that the build system doesn't depend on it"""
+        base_path = build_folder_path.joinpath(SIZE_REPORT_FILE_NAME)
+        base_path.with_suffix(".txt").write_text(self.to_text(), encoding="utf-8")
+        with base_path.with_suffix(".json").open("w", encoding="utf-8") as json_file:
+            json.dump(self.to_dict(), json_file, indent=2)